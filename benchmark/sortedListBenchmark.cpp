@@ -0,0 +1,962 @@
+/*
+ * Benchmarks of the hot paths of SortedList, its variants and ExamDetails.
+ *
+ * Every case runs on the sizes 1e3, 1e4, ... 1e7 (up to its own limit) and reports the best time of a few
+ * repetitions. Only the measured part of a case is timed - building its input is not. Results are printed one
+ * line per case and size as CSV (default) or JSON, so runs can be compared by a script:
+ *     sorted_list_benchmark [--min-size N] [--max-size N] [--repetitions N] [--filter TEXT]
+ *                           [--format csv|json] [--output PATH]
+ */
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "concurrentSortedList.h"
+#include "examCalendar.h"
+#include "examConflicts.h"
+#include "examDetails.h"
+#include "examLoader.h"
+#include "examStorage.h"
+#include "examWriter.h"
+#include "nodePool.h"
+#include "sortedList.h"
+#include "sortedListStorage.h"
+#include "sortedVector.h"
+
+namespace
+{
+    using mtm::ExamDetails;
+    using mtm::SortedList;
+    using std::string;
+
+    const int smallest_size = 1000;
+    const int biggest_size = 10000000;
+    const int default_repetitions = 3;
+    const unsigned int data_seed = 20240601u;
+    // cases whose cost grows faster than n log n, or that produce output per element, stop at these sizes.
+    const int quadratic_size_limit = 10000;
+    const int vector_insert_size_limit = 100000;
+    const int output_size_limit = 1000000;
+    // how far an element of a jittered stream may be from its sorted place.
+    const int jitter_distance = 4;
+    const int link_count = 16;
+    // the layout of the date and the hour tolerance ExamDetails compared with before it kept a sort key.
+    const int legacy_days_in_month = 30;
+    const int legacy_slots_in_day = 48;
+    const double legacy_epsilon = 0.000001;
+
+    // results are added here, so the compiler can't drop the measured work.
+    volatile long benchmark_sink = 0;
+
+    /*
+     * Accumulates the time between start and stop calls - a case times only its measured part.
+     */
+    class Stopwatch
+    {
+        std::chrono::steady_clock::time_point started;
+        double total;
+
+    public:
+        Stopwatch() : total(0) {}
+        void start() { this->started = std::chrono::steady_clock::now(); }
+        void stop()
+        {
+            this->total += std::chrono::duration<double>(std::chrono::steady_clock::now() - this->started).count();
+        }
+        double seconds() const { return this->total; }
+    };
+
+    /*
+     * One benchmark: its body builds the input for size, times the measured part with the stopwatch and returns
+     * the number of operations it timed.
+     */
+    class Case
+    {
+    public:
+        string name;
+        int size_limit;
+        std::function<long(const int size, Stopwatch &stopwatch)> body;
+        Case(const string &name, const int size_limit, const std::function<long(const int, Stopwatch &)> &body)
+            : name(name), size_limit(size_limit), body(body)
+        {
+        }
+    };
+
+    class Result
+    {
+    public:
+        string name;
+        int size;
+        int repetitions;
+        long operations;
+        double seconds;
+    };
+
+    /*
+     * Prints results as they come, so a long run can be followed and a killed run still leaves its results.
+     */
+    class Reporter
+    {
+        std::ostream &os;
+        bool json;
+        bool first;
+
+    public:
+        Reporter(std::ostream &os, const bool json) : os(os), json(json), first(true)
+        {
+            if (this->json)
+            {
+                this->os << "{\n  \"benchmarks\": [";
+            }
+            else
+            {
+                this->os << "name,size,repetitions,operations,seconds,ns_per_op\n";
+            }
+        }
+
+        void report(const Result &result)
+        {
+            char ns_per_op[32], seconds[32];
+            std::snprintf(ns_per_op, sizeof(ns_per_op), "%.3f",
+                          result.operations == 0 ? 0.0 : result.seconds * 1e9 / result.operations);
+            std::snprintf(seconds, sizeof(seconds), "%.6f", result.seconds);
+            if (this->json)
+            {
+                this->os << (this->first ? "\n" : ",\n") << "    {\"name\": \"" << result.name
+                         << "\", \"size\": " << result.size << ", \"repetitions\": " << result.repetitions
+                         << ", \"operations\": " << result.operations << ", \"seconds\": " << seconds
+                         << ", \"ns_per_op\": " << ns_per_op << "}";
+            }
+            else
+            {
+                this->os << result.name << "," << result.size << "," << result.repetitions << ","
+                         << result.operations << "," << seconds << "," << ns_per_op << "\n";
+            }
+            this->first = false;
+            this->os.flush();
+        }
+
+        void finish()
+        {
+            if (this->json)
+            {
+                this->os << "\n  ]\n}\n";
+            }
+            this->os.flush();
+        }
+    };
+
+    /*
+     * Hand written orders, to compare with the same orders given to SortedList as Compare and KeyOf.
+     */
+    class ReversedInt
+    {
+    public:
+        int value;
+        ReversedInt(const int value) : value(value) {}
+        bool operator<(const ReversedInt &other) const { return other.value < this->value; }
+    };
+
+    class ExamByCourse
+    {
+    public:
+        ExamDetails exam;
+        ExamByCourse(const ExamDetails &exam) : exam(exam) {}
+        bool operator<(const ExamByCourse &other) const { return this->exam.getCourseId() < other.exam.getCourseId(); }
+    };
+
+    /*
+     * The date and hour of an exam, ordered the way ExamDetails::operator< did before the sort key: the difference
+     * in days first, then the start hours with an epsilon, so exam/compare_legacy shows what the sort key saves.
+     */
+    class LegacyExamTime
+    {
+    public:
+        int month, day;
+        double hour;
+        LegacyExamTime(const ExamDetails &exam)
+        {
+            int day_of_year = exam.getSortKey() / legacy_slots_in_day;
+            this->month = day_of_year / legacy_days_in_month + 1;
+            this->day = day_of_year % legacy_days_in_month + 1;
+            this->hour = (exam.getSortKey() % legacy_slots_in_day) / 2.0;
+        }
+
+        int operator-(const LegacyExamTime &other) const
+        {
+            return (this->month - other.month) * legacy_days_in_month + this->day - other.day;
+        }
+
+        bool operator<(const LegacyExamTime &other) const
+        {
+            int days_diff = *this - other;
+            if (days_diff < 0)
+            {
+                return true;
+            }
+            else if (days_diff > 0)
+            {
+                return false;
+            }
+            if (this->hour >= other.hour)
+            {
+                return false;
+            }
+            return other.hour - this->hour >= legacy_epsilon;
+        }
+    };
+
+    /*==============================INPUT DATA==============================*/
+    std::vector<int> randomInts(const int size)
+    {
+        std::mt19937 generator(data_seed);
+        std::vector<int> values(size);
+        for (int i = 0; i < size; i++)
+        {
+            values[i] = (int)(generator() >> 1);
+        }
+        return values;
+    }
+
+    std::vector<int> ascendingInts(const int size)
+    {
+        std::vector<int> values(size);
+        for (int i = 0; i < size; i++)
+        {
+            values[i] = i;
+        }
+        return values;
+    }
+
+    /*
+     * Ascending values where every value is moved up to jitter_distance places from its sorted place, like a feed
+     * that arrives almost in order.
+     */
+    std::vector<int> jitteredInts(const int size)
+    {
+        std::mt19937 generator(data_seed);
+        std::vector<int> values(size);
+        for (int i = 0; i < size; i++)
+        {
+            values[i] = i + (int)(generator() % (2 * jitter_distance + 1)) - jitter_distance;
+        }
+        return values;
+    }
+
+    template <class List>
+    long insertAllHinted(const std::vector<int> &values, Stopwatch &stopwatch)
+    {
+        List list;
+        typename List::const_iterator hint = list.end();
+        stopwatch.start();
+        for (std::vector<int>::const_iterator it = values.begin(); it != values.end(); ++it)
+        {
+            hint = list.insert(hint, *it);
+        }
+        stopwatch.stop();
+        benchmark_sink += list.length();
+        return (long)values.size();
+    }
+
+    std::vector<ExamDetails> randomExams(const int size, const int longest_duration = 3)
+    {
+        std::mt19937 generator(data_seed);
+        std::vector<string> links;
+        for (int i = 0; i < link_count; i++)
+        {
+            links.push_back("https://tinyurl.com/exam" + std::to_string(i));
+        }
+        std::vector<ExamDetails> exams;
+        exams.reserve(size);
+        for (int i = 0; i < size; i++)
+        {
+            exams.push_back(ExamDetails(i, (int)(generator() % 12) + 1, (int)(generator() % 30) + 1,
+                                        (generator() % 48) / 2.0, (int)(generator() % (longest_duration + 1)),
+                                        links[generator() % link_count]));
+        }
+        return exams;
+    }
+
+    SortedList<int> intList(const int size)
+    {
+        std::vector<int> values = randomInts(size);
+        return SortedList<int>(values.begin(), values.end());
+    }
+
+    SortedList<ExamDetails> examCalendar(const int size, const int longest_duration = 3)
+    {
+        std::vector<ExamDetails> exams = randomExams(size, longest_duration);
+        return SortedList<ExamDetails>(exams.begin(), exams.end());
+    }
+
+    template <class List>
+    long sumOf(const List &list)
+    {
+        long sum = 0;
+        for (typename List::const_iterator it = list.begin(); !(it == list.end()); ++it)
+        {
+            sum += *it;
+        }
+        return sum;
+    }
+
+    std::vector<unsigned int> threadCounts()
+    {
+        std::vector<unsigned int> counts;
+        unsigned int hardware = std::max(1u, std::thread::hardware_concurrency());
+        for (unsigned int threads = 1; threads < hardware; threads *= 2)
+        {
+            counts.push_back(threads);
+        }
+        counts.push_back(hardware);
+        return counts;
+    }
+
+    /*==============================SORTED LIST CASES==============================*/
+    template <class List>
+    long insertAll(const std::vector<int> &values, Stopwatch &stopwatch)
+    {
+        List list;
+        stopwatch.start();
+        for (std::vector<int>::const_iterator it = values.begin(); it != values.end(); ++it)
+        {
+            list.insert(*it);
+        }
+        stopwatch.stop();
+        benchmark_sink += list.length();
+        return (long)values.size();
+    }
+
+    void addSortedListCases(std::vector<Case> &cases)
+    {
+        cases.push_back(Case("sortedlist/insert_random", biggest_size, [](const int size, Stopwatch &stopwatch) {
+            return insertAll<SortedList<int>>(randomInts(size), stopwatch);
+        }));
+        cases.push_back(Case("sortedlist/insert_ascending", biggest_size, [](const int size, Stopwatch &stopwatch) {
+            return insertAll<SortedList<int>>(ascendingInts(size), stopwatch);
+        }));
+        cases.push_back(Case("sortedlist/insert_descending", biggest_size, [](const int size, Stopwatch &stopwatch) {
+            std::vector<int> values = ascendingInts(size);
+            std::reverse(values.begin(), values.end());
+            return insertAll<SortedList<int>>(values, stopwatch);
+        }));
+        cases.push_back(Case("sortedlist/insert_jittered", biggest_size, [](const int size, Stopwatch &stopwatch) {
+            return insertAll<SortedList<int>>(jitteredInts(size), stopwatch);
+        }));
+        cases.push_back(Case("sortedlist/hint_ascending", biggest_size, [](const int size, Stopwatch &stopwatch) {
+            return insertAllHinted<SortedList<int>>(ascendingInts(size), stopwatch);
+        }));
+        cases.push_back(Case("sortedlist/hint_descending", biggest_size, [](const int size, Stopwatch &stopwatch) {
+            std::vector<int> values = ascendingInts(size);
+            std::reverse(values.begin(), values.end());
+            return insertAllHinted<SortedList<int>>(values, stopwatch);
+        }));
+        cases.push_back(Case("sortedlist/hint_jittered", biggest_size, [](const int size, Stopwatch &stopwatch) {
+            return insertAllHinted<SortedList<int>>(jitteredInts(size), stopwatch);
+        }));
+        cases.push_back(Case("sortedlist/insert_random_pool", biggest_size, [](const int size, Stopwatch &stopwatch) {
+            std::vector<int> values = randomInts(size);
+            mtm::NodePool pool;
+            SortedList<int, std::less<int>, mtm::IdentityKey<int>, mtm::PoolAllocator<int>> list(
+                (mtm::PoolAllocator<int>(pool)));
+            stopwatch.start();
+            for (std::vector<int>::const_iterator it = values.begin(); it != values.end(); ++it)
+            {
+                list.insert(*it);
+            }
+            stopwatch.stop();
+            benchmark_sink += list.length();
+            return (long)size;
+        }));
+        cases.push_back(Case("sortedlist/pool_destroy", biggest_size, [](const int size, Stopwatch &stopwatch) {
+            mtm::NodePool pool;
+            typedef SortedList<int, std::less<int>, mtm::IdentityKey<int>, mtm::PoolAllocator<int>> PoolList;
+            std::vector<int> values = randomInts(size);
+            PoolList list(values.begin(), values.end(), mtm::PoolAllocator<int>(pool));
+            stopwatch.start();
+            list = PoolList(mtm::PoolAllocator<int>(pool));
+            pool.release();
+            stopwatch.stop();
+            return (long)size;
+        }));
+        cases.push_back(Case("sortedlist/pool_drop_release", biggest_size, [](const int size, Stopwatch &stopwatch) {
+            mtm::NodePool pool;
+            typedef SortedList<int, std::less<int>, mtm::IdentityKey<int>, mtm::PoolAllocator<int>> PoolList;
+            std::vector<int> values = randomInts(size);
+            PoolList list(values.begin(), values.end(), mtm::PoolAllocator<int>(pool));
+            stopwatch.start();
+            list.dropNodes();
+            pool.release();
+            stopwatch.stop();
+            return (long)size;
+        }));
+        cases.push_back(Case("sortedlist/insert_range", biggest_size, [](const int size, Stopwatch &stopwatch) {
+            std::vector<int> values = randomInts(size);
+            SortedList<int> list;
+            stopwatch.start();
+            list.insertRange(values.begin(), values.end());
+            stopwatch.stop();
+            benchmark_sink += list.length();
+            return (long)size;
+        }));
+        cases.push_back(Case("sortedlist/remove_random", biggest_size, [](const int size, Stopwatch &stopwatch) {
+            std::vector<int> values = randomInts(size);
+            SortedList<int> list;
+            std::vector<SortedList<int>::const_iterator> positions;
+            positions.reserve(size);
+            for (std::vector<int>::const_iterator it = values.begin(); it != values.end(); ++it)
+            {
+                positions.push_back(list.insert(*it));
+            }
+            std::shuffle(positions.begin(), positions.end(), std::mt19937(data_seed));
+            stopwatch.start();
+            for (std::vector<SortedList<int>::const_iterator>::const_iterator it = positions.begin();
+                 it != positions.end(); ++it)
+            {
+                list.remove(*it);
+            }
+            stopwatch.stop();
+            benchmark_sink += list.length();
+            return (long)size;
+        }));
+        cases.push_back(Case("sortedlist/remove_if_half", biggest_size, [](const int size, Stopwatch &stopwatch) {
+            SortedList<int> list = intList(size);
+            stopwatch.start();
+            int removed = list.removeIf([](const int value) { return value % 2 == 0; });
+            stopwatch.stop();
+            benchmark_sink += removed;
+            return (long)size;
+        }));
+        cases.push_back(Case("sortedlist/erase_half", biggest_size, [](const int size, Stopwatch &stopwatch) {
+            SortedList<int> list = intList(size);
+            SortedList<int>::const_iterator middle = list.begin();
+            for (int i = 0; i < size / 2; i++)
+            {
+                ++middle;
+            }
+            stopwatch.start();
+            int removed = list.erase(list.begin(), middle);
+            stopwatch.stop();
+            benchmark_sink += removed;
+            return (long)(size / 2);
+        }));
+        cases.push_back(Case("sortedlist/iterate", biggest_size, [](const int size, Stopwatch &stopwatch) {
+            SortedList<int> list = intList(size);
+            stopwatch.start();
+            benchmark_sink += sumOf(list);
+            stopwatch.stop();
+            return (long)size;
+        }));
+        cases.push_back(Case("sortedlist/find", biggest_size, [](const int size, Stopwatch &stopwatch) {
+            std::vector<int> values = randomInts(size);
+            SortedList<int> list(values.begin(), values.end());
+            std::shuffle(values.begin(), values.end(), std::mt19937(data_seed + 1));
+            stopwatch.start();
+            for (std::vector<int>::const_iterator it = values.begin(); it != values.end(); ++it)
+            {
+                benchmark_sink += list.contains(*it);
+            }
+            stopwatch.stop();
+            return (long)size;
+        }));
+        cases.push_back(Case("sortedlist/filter", biggest_size, [](const int size, Stopwatch &stopwatch) {
+            SortedList<int> list = intList(size);
+            stopwatch.start();
+            SortedList<int> result = list.filter([](const int value) { return value % 2 == 0; });
+            stopwatch.stop();
+            benchmark_sink += result.length();
+            return (long)size;
+        }));
+        cases.push_back(Case("sortedlist/apply", biggest_size, [](const int size, Stopwatch &stopwatch) {
+            SortedList<int> list = intList(size);
+            stopwatch.start();
+            SortedList<int> result = list.apply([](const int value) { return value / 2; });
+            stopwatch.stop();
+            benchmark_sink += result.length();
+            return (long)size;
+        }));
+        std::vector<unsigned int> counts = threadCounts();
+        for (std::vector<unsigned int>::const_iterator threads = counts.begin(); threads != counts.end(); ++threads)
+        {
+            const unsigned int thread_count = *threads;
+            cases.push_back(Case("sortedlist/filter_parallel/threads:" + std::to_string(thread_count), biggest_size,
+                                 [thread_count](const int size, Stopwatch &stopwatch) {
+                                     SortedList<int> list = intList(size);
+                                     stopwatch.start();
+                                     SortedList<int> result = list.filter(mtm::ParallelPolicy(thread_count),
+                                                                          [](const int value) { return value % 2 == 0; });
+                                     stopwatch.stop();
+                                     benchmark_sink += result.length();
+                                     return (long)size;
+                                 }));
+            cases.push_back(Case("sortedlist/apply_parallel/threads:" + std::to_string(thread_count), biggest_size,
+                                 [thread_count](const int size, Stopwatch &stopwatch) {
+                                     SortedList<int> list = intList(size);
+                                     stopwatch.start();
+                                     SortedList<int> result = list.apply(mtm::ParallelPolicy(thread_count),
+                                                                         [](const int value) { return value / 2; });
+                                     stopwatch.stop();
+                                     benchmark_sink += result.length();
+                                     return (long)size;
+                                 }));
+        }
+        cases.push_back(Case("sortedlist/copy_construct", biggest_size, [](const int size, Stopwatch &stopwatch) {
+            SortedList<int> list = intList(size);
+            stopwatch.start();
+            SortedList<int> copy(list);
+            stopwatch.stop();
+            benchmark_sink += copy.length();
+            return (long)size;
+        }));
+        cases.push_back(Case("sortedlist/copy_assign", biggest_size, [](const int size, Stopwatch &stopwatch) {
+            SortedList<int> list = intList(size);
+            SortedList<int> copy = intList(size / 2);
+            stopwatch.start();
+            copy = list;
+            stopwatch.stop();
+            benchmark_sink += copy.length();
+            return (long)size;
+        }));
+        cases.push_back(Case("sortedlist/save_load", biggest_size, [](const int size, Stopwatch &stopwatch) {
+            SortedList<int> list = intList(size);
+            SortedList<int> loaded;
+            stopwatch.start();
+            std::stringstream stream;
+            mtm::saveSortedList(list, stream);
+            mtm::loadSortedList(stream, loaded);
+            stopwatch.stop();
+            benchmark_sink += loaded.length();
+            return (long)size;
+        }));
+        cases.push_back(Case("sortedlist/mapped_open_iterate", biggest_size, [](const int size, Stopwatch &stopwatch) {
+            SortedList<int> list = intList(size);
+            char path[] = "/tmp/sorted_list_benchmarkXXXXXX";
+            int fd = ::mkstemp(path);
+            if (fd < 0)
+            {
+                throw std::runtime_error("can't create a temporary file");
+            }
+            ::close(fd);
+            {
+                std::ofstream file(path, std::ios::out | std::ios::binary);
+                mtm::saveSortedList(list, file);
+            }
+            stopwatch.start();
+            {
+                mtm::MappedSortedList<int> mapped(path);
+                benchmark_sink += sumOf(mapped);
+            }
+            stopwatch.stop();
+            ::unlink(path);
+            return (long)size;
+        }));
+    }
+
+    /*==============================VARIANT CASES==============================*/
+    void addVariantCases(std::vector<Case> &cases)
+    {
+        cases.push_back(Case("order/insert_greater_compare", biggest_size, [](const int size, Stopwatch &stopwatch) {
+            return insertAll<SortedList<int, std::greater<int>>>(randomInts(size), stopwatch);
+        }));
+        cases.push_back(Case("order/insert_greater_handwritten", biggest_size, [](const int size, Stopwatch &stopwatch) {
+            return insertAll<SortedList<ReversedInt>>(randomInts(size), stopwatch);
+        }));
+        cases.push_back(Case("order/exam_by_course_keyof", biggest_size, [](const int size, Stopwatch &stopwatch) {
+            std::vector<ExamDetails> exams = randomExams(size);
+            std::shuffle(exams.begin(), exams.end(), std::mt19937(data_seed));
+            SortedList<ExamDetails, std::less<int>, mtm::ExamCourseKey> calendar;
+            stopwatch.start();
+            for (std::vector<ExamDetails>::const_iterator it = exams.begin(); it != exams.end(); ++it)
+            {
+                calendar.insert(*it);
+            }
+            stopwatch.stop();
+            benchmark_sink += calendar.length();
+            return (long)size;
+        }));
+        cases.push_back(Case("order/exam_by_course_handwritten", biggest_size, [](const int size, Stopwatch &stopwatch) {
+            std::vector<ExamDetails> exams = randomExams(size);
+            std::shuffle(exams.begin(), exams.end(), std::mt19937(data_seed));
+            SortedList<ExamByCourse> calendar;
+            stopwatch.start();
+            for (std::vector<ExamDetails>::const_iterator it = exams.begin(); it != exams.end(); ++it)
+            {
+                calendar.insert(*it);
+            }
+            stopwatch.stop();
+            benchmark_sink += calendar.length();
+            return (long)size;
+        }));
+        cases.push_back(Case("sortedvector/insert_random", vector_insert_size_limit,
+                             [](const int size, Stopwatch &stopwatch) {
+                                 return insertAll<mtm::SortedVector<int>>(randomInts(size), stopwatch);
+                             }));
+        cases.push_back(Case("sortedvector/iterate", biggest_size, [](const int size, Stopwatch &stopwatch) {
+            std::vector<int> values = randomInts(size);
+            mtm::SortedVector<int> vector(values.begin(), values.end());
+            stopwatch.start();
+            benchmark_sink += sumOf(vector);
+            stopwatch.stop();
+            return (long)size;
+        }));
+        cases.push_back(Case("sortedvector/find", biggest_size, [](const int size, Stopwatch &stopwatch) {
+            std::vector<int> values = randomInts(size);
+            mtm::SortedVector<int> vector(values.begin(), values.end());
+            std::shuffle(values.begin(), values.end(), std::mt19937(data_seed + 1));
+            stopwatch.start();
+            for (std::vector<int>::const_iterator it = values.begin(); it != values.end(); ++it)
+            {
+                benchmark_sink += vector.contains(*it);
+            }
+            stopwatch.stop();
+            return (long)size;
+        }));
+        std::vector<unsigned int> counts = threadCounts();
+        for (std::vector<unsigned int>::const_iterator threads = counts.begin(); threads != counts.end(); ++threads)
+        {
+            const unsigned int thread_count = *threads;
+            cases.push_back(Case("concurrent/insert_contains/threads:" + std::to_string(thread_count),
+                                 quadratic_size_limit, [thread_count](const int size, Stopwatch &stopwatch) {
+                                     std::vector<int> values = randomInts(size);
+                                     mtm::ConcurrentSortedList<int> list;
+                                     std::vector<std::thread> workers;
+                                     std::vector<long> found(thread_count, 0);
+                                     stopwatch.start();
+                                     for (unsigned int worker = 0; worker < thread_count; worker++)
+                                     {
+                                         workers.push_back(std::thread([&values, &list, &found, worker, thread_count]() {
+                                             for (std::size_t i = worker; i < values.size(); i += thread_count)
+                                             {
+                                                 list.insert(values[i]);
+                                                 found[worker] += list.contains(values[i]);
+                                             }
+                                         }));
+                                     }
+                                     for (std::size_t i = 0; i < workers.size(); i++)
+                                     {
+                                         workers[i].join();
+                                         benchmark_sink += found[i];
+                                     }
+                                     stopwatch.stop();
+                                     return 2L * size;
+                                 }));
+        }
+    }
+
+    /*==============================EXAM CASES==============================*/
+    void addExamCases(std::vector<Case> &cases)
+    {
+        cases.push_back(Case("exam/construct", biggest_size, [](const int size, Stopwatch &stopwatch) {
+            const string link = "https://tinyurl.com/exam";
+            stopwatch.start();
+            for (int i = 0; i < size; i++)
+            {
+                ExamDetails exam(i, i % 12 + 1, i % 30 + 1, (i % 48) / 2.0, i % 4, link);
+                benchmark_sink += exam.getSortKey();
+            }
+            stopwatch.stop();
+            return (long)size;
+        }));
+        cases.push_back(Case("exam/compare", biggest_size, [](const int size, Stopwatch &stopwatch) {
+            std::vector<ExamDetails> exams = randomExams(size);
+            long earlier = 0;
+            stopwatch.start();
+            for (int i = 1; i < size; i++)
+            {
+                earlier += exams[i - 1] < exams[i];
+            }
+            stopwatch.stop();
+            benchmark_sink += earlier;
+            return (long)size - 1;
+        }));
+        cases.push_back(Case("exam/compare_legacy", biggest_size, [](const int size, Stopwatch &stopwatch) {
+            std::vector<ExamDetails> exams = randomExams(size);
+            std::vector<LegacyExamTime> times(exams.begin(), exams.end());
+            long earlier = 0;
+            stopwatch.start();
+            for (int i = 1; i < size; i++)
+            {
+                earlier += times[i - 1] < times[i];
+            }
+            stopwatch.stop();
+            benchmark_sink += earlier;
+            return (long)size - 1;
+        }));
+        cases.push_back(Case("exam/stable_sort", biggest_size, [](const int size, Stopwatch &stopwatch) {
+            std::vector<ExamDetails> exams = randomExams(size);
+            stopwatch.start();
+            std::stable_sort(exams.begin(), exams.end());
+            stopwatch.stop();
+            benchmark_sink += exams.front().getSortKey();
+            return (long)size;
+        }));
+        cases.push_back(Case("exam/insert_range", biggest_size, [](const int size, Stopwatch &stopwatch) {
+            std::vector<ExamDetails> exams = randomExams(size);
+            SortedList<ExamDetails> calendar;
+            stopwatch.start();
+            calendar.insertRange(exams.begin(), exams.end());
+            stopwatch.stop();
+            benchmark_sink += calendar.length();
+            return (long)size;
+        }));
+        cases.push_back(Case("exam/insert_random", biggest_size, [](const int size, Stopwatch &stopwatch) {
+            std::vector<ExamDetails> exams = randomExams(size);
+            SortedList<ExamDetails> calendar;
+            stopwatch.start();
+            for (std::vector<ExamDetails>::const_iterator it = exams.begin(); it != exams.end(); ++it)
+            {
+                calendar.insert(*it);
+            }
+            stopwatch.stop();
+            benchmark_sink += calendar.length();
+            return (long)size;
+        }));
+        cases.push_back(Case("exam/print_operator", output_size_limit, [](const int size, Stopwatch &stopwatch) {
+            SortedList<ExamDetails> calendar = examCalendar(size);
+            std::ofstream null_output("/dev/null");
+            stopwatch.start();
+            for (SortedList<ExamDetails>::const_iterator it = calendar.begin(); !(it == calendar.end()); ++it)
+            {
+                null_output << *it;
+            }
+            stopwatch.stop();
+            return (long)size;
+        }));
+        cases.push_back(Case("exam/print_writer", output_size_limit, [](const int size, Stopwatch &stopwatch) {
+            SortedList<ExamDetails> calendar = examCalendar(size);
+            int fd = ::open("/dev/null", O_WRONLY);
+            stopwatch.start();
+            mtm::ExamWriter::write(calendar, fd);
+            stopwatch.stop();
+            ::close(fd);
+            return (long)size;
+        }));
+        cases.push_back(Case("exam/load_csv", biggest_size, [](const int size, Stopwatch &stopwatch) {
+            std::vector<ExamDetails> exams = randomExams(size);
+            std::ostringstream csv;
+            for (int i = 0; i < size; i++)
+            {
+                const ExamDetails &exam = exams[i];
+                int day_of_year = exam.getSortKey() / 48;
+                csv << exam.getCourseId() << "," << day_of_year / 30 + 1 << "," << day_of_year % 30 + 1 << ","
+                    << (exam.getSortKey() % 48) / 2.0 << "," << exam.getDuration() << "," << exam.getLink() << "\n";
+            }
+            std::istringstream input(csv.str());
+            SortedList<ExamDetails> calendar;
+            stopwatch.start();
+            mtm::ExamLoader::Report report = mtm::ExamLoader::load(input, calendar);
+            stopwatch.stop();
+            benchmark_sink += report.rows_loaded;
+            return (long)size;
+        }));
+        cases.push_back(Case("exam/save_load", biggest_size, [](const int size, Stopwatch &stopwatch) {
+            SortedList<ExamDetails> calendar = examCalendar(size);
+            SortedList<ExamDetails> loaded;
+            stopwatch.start();
+            std::stringstream stream;
+            mtm::saveSortedList(calendar, stream);
+            mtm::loadSortedList(stream, loaded);
+            stopwatch.stop();
+            benchmark_sink += loaded.length();
+            return (long)size;
+        }));
+        cases.push_back(Case("exam/update_link_scan", quadratic_size_limit, [](const int size, Stopwatch &stopwatch) {
+            SortedList<ExamDetails> calendar = examCalendar(size);
+            const string link = "https://tinyurl.com/moved";
+            stopwatch.start();
+            for (int course_id = 0; course_id < size; course_id++)
+            {
+                SortedList<ExamDetails>::const_iterator it = calendar.begin();
+                while ((*it).getCourseId() != course_id)
+                {
+                    ++it;
+                }
+                ExamDetails updated = *it;
+                updated.setLink(link);
+                calendar.remove(it);
+                calendar.insert(updated);
+            }
+            stopwatch.stop();
+            benchmark_sink += calendar.length();
+            return (long)size;
+        }));
+        cases.push_back(Case("exam/update_link_indexed", biggest_size, [](const int size, Stopwatch &stopwatch) {
+            mtm::ExamCalendar calendar(examCalendar(size));
+            const string link = "https://tinyurl.com/moved";
+            stopwatch.start();
+            for (int course_id = 0; course_id < size; course_id++)
+            {
+                calendar.setLink(course_id, link);
+            }
+            stopwatch.stop();
+            benchmark_sink += calendar.length();
+            return (long)size;
+        }));
+        cases.push_back(Case("exam/remove_by_course_indexed", biggest_size, [](const int size, Stopwatch &stopwatch) {
+            mtm::ExamCalendar calendar(examCalendar(size));
+            stopwatch.start();
+            for (int course_id = 0; course_id < size; course_id++)
+            {
+                calendar.remove(course_id);
+            }
+            stopwatch.stop();
+            benchmark_sink += calendar.length();
+            return (long)size;
+        }));
+        cases.push_back(Case("exam/find_overlaps", output_size_limit, [](const int size, Stopwatch &stopwatch) {
+            SortedList<ExamDetails> calendar = examCalendar(size, 1);
+            long overlaps = 0;
+            stopwatch.start();
+            mtm::ExamConflicts::forEachOverlap(calendar,
+                                               [&overlaps](const ExamDetails &, const ExamDetails &) { overlaps++; });
+            stopwatch.stop();
+            benchmark_sink += overlaps;
+            return (long)size;
+        }));
+    }
+
+    /*==============================DRIVER==============================*/
+    class Options
+    {
+    public:
+        int min_size;
+        int max_size;
+        int repetitions;
+        string filter;
+        bool json;
+        string output;
+        Options() : min_size(smallest_size), max_size(biggest_size), repetitions(default_repetitions), json(false)
+        {
+        }
+    };
+
+    void printUsage()
+    {
+        std::cerr << "usage: sorted_list_benchmark [--min-size N] [--max-size N] [--repetitions N] [--filter TEXT]"
+                     " [--format csv|json] [--output PATH]"
+                  << std::endl;
+    }
+
+    bool parseOptions(const int argc, char **argv, Options &options)
+    {
+        for (int i = 1; i < argc; i++)
+        {
+            string option = argv[i];
+            if (i + 1 == argc)
+            {
+                return false;
+            }
+            string value = argv[++i];
+            if (option == "--min-size")
+            {
+                options.min_size = std::atoi(value.c_str());
+            }
+            else if (option == "--max-size")
+            {
+                options.max_size = std::atoi(value.c_str());
+            }
+            else if (option == "--repetitions")
+            {
+                options.repetitions = std::max(1, std::atoi(value.c_str()));
+            }
+            else if (option == "--filter")
+            {
+                options.filter = value;
+            }
+            else if (option == "--format" && (value == "csv" || value == "json"))
+            {
+                options.json = value == "json";
+            }
+            else if (option == "--output")
+            {
+                options.output = value;
+            }
+            else
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    Result runCase(const Case &benchmark, const int size, const int repetitions)
+    {
+        Result result;
+        result.name = benchmark.name;
+        result.size = size;
+        result.repetitions = repetitions;
+        result.operations = 0;
+        result.seconds = 0;
+        for (int repetition = 0; repetition < repetitions; repetition++)
+        {
+            Stopwatch stopwatch;
+            long operations = benchmark.body(size, stopwatch);
+            if (repetition == 0 || stopwatch.seconds() < result.seconds)
+            {
+                result.seconds = stopwatch.seconds();
+                result.operations = operations;
+            }
+        }
+        return result;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    Options options;
+    if (!parseOptions(argc, argv, options))
+    {
+        printUsage();
+        return 1;
+    }
+
+    std::ofstream output_file;
+    if (!options.output.empty())
+    {
+        output_file.open(options.output.c_str());
+        if (!output_file)
+        {
+            std::cerr << "can't open " << options.output << std::endl;
+            return 1;
+        }
+    }
+    std::ostream &output = options.output.empty() ? std::cout : output_file;
+
+    std::vector<Case> cases;
+    addSortedListCases(cases);
+    addVariantCases(cases);
+    addExamCases(cases);
+
+    Reporter reporter(output, options.json);
+    for (std::vector<Case>::const_iterator it = cases.begin(); it != cases.end(); ++it)
+    {
+        if (it->name.find(options.filter) == string::npos)
+        {
+            continue;
+        }
+        for (int size = smallest_size; size <= biggest_size; size *= 10)
+        {
+            if (size < options.min_size || size > options.max_size || size > it->size_limit)
+            {
+                continue;
+            }
+            reporter.report(runCase(*it, size, options.repetitions));
+        }
+    }
+    reporter.finish();
+    return 0;
+}
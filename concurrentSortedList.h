@@ -0,0 +1,272 @@
+#ifndef CONCURRENT_SORTED_LIST_H
+#define CONCURRENT_SORTED_LIST_H
+#include <atomic>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "sortedList.h"
+
+namespace mtm
+{
+    /*
+     * ConcurrentSortedList is a sorted list that many threads may insert to, remove from and traverse at the same
+     * time. Every node has its own lock, and every operation walks the list hand over hand - it locks the next
+     * node before it releases the current one. Threads working on different parts of the list never wait for each
+     * other, and a writer only blocks the readers that reach the two nodes it is changing.
+     * A node is unlinked while both it and its predecessor are locked, so no other thread can hold or wait for it
+     * and it is deallocated right away, without any deferred reclamation.
+     */
+    template <class T>
+    class ConcurrentSortedList
+    {
+        class Element;
+
+        class Link
+        {
+        public:
+            std::mutex lock;
+            Element *next;
+            Link() : next(nullptr) {}
+        };
+
+        class Element : public Link
+        {
+        public:
+            T data;
+            template <class... Args>
+            explicit Element(Args &&...args) : Link(), data(std::forward<Args>(args)...) {}
+        };
+
+        Link head;
+        std::atomic<int> size;
+
+        /**
+         * @brief Walks the list hand over hand as long as go_past allows moving to the next node.
+         * If go_past throws, every lock is released before the exception goes on.
+         * @param go_past - called with the data of the next node, true - move to it, false - stop before it.
+         * @return the last node walked to, still locked (the head if go_past is false for the first element).
+         */
+        template <class GoPast>
+        Link *lockPredecessor(GoPast go_past);
+
+    public:
+        /**
+         * @brief Constructs a new empty list.
+         */
+        ConcurrentSortedList();
+
+        ConcurrentSortedList(const ConcurrentSortedList &list) = delete;
+        ConcurrentSortedList &operator=(const ConcurrentSortedList &list) = delete;
+
+        /**
+         * @brief Dealocates a list and all it's elements. No other thread may use the list at that time.
+         */
+        ~ConcurrentSortedList();
+
+        /**
+         * @brief inserts a new data to the list while keeping it sorted, safe to call from several threads.
+         * Equal elements keep their insertion order.
+         * @param data - new data we want to insert into the list.
+         * @return (void)
+         */
+        void insert(const T &data);
+
+        /**
+         * @brief Constructs a new element and inserts it while keeping the list sorted.
+         * @param args - arguments for the constructor of the new element.
+         * @return (void)
+         */
+        template <class... Args>
+        void emplace(Args &&...args);
+
+        /**
+         * @brief Removes the first element equal to data, safe to call from several threads.
+         * @param data - data to remove.
+         * @return true - if an element was removed, false - if there is no element equal to data.
+         */
+        bool remove(const T &data);
+
+        /**
+         * @brief Checks if the list holds an element equal to data.
+         * @param data - data to search for.
+         * @return true - if an equal element is in the list, false - otherwise.
+         */
+        bool contains(const T &data);
+
+        /**
+         * @brief Length
+         * @return Returns the number of elements in the list at the moment of the call.
+         */
+        int length() const;
+
+        /**
+         * @brief Runs over the list elements in order, hand over hand, while other threads keep changing it.
+         * Every element that is in the list during the whole traversal is visited exactly once; elements inserted
+         * or removed during the traversal may or may not be visited.
+         * @param visit - called with every element visited, must not use this list.
+         * @return (void)
+         */
+        template <class Visit>
+        void forEach(Visit visit);
+
+        /**
+         * @brief Copies the list elements into a regular SortedList, traversing like forEach.
+         * @return A new SortedList with the elements of the list.
+         */
+        SortedList<T> snapshot();
+    };
+
+    template <class T>
+    ConcurrentSortedList<T>::ConcurrentSortedList() : head(), size(0)
+    {
+    }
+
+    template <class T>
+    ConcurrentSortedList<T>::~ConcurrentSortedList()
+    {
+        Element *tmp = this->head.next;
+        while (tmp != nullptr)
+        {
+            Element *to_delete = tmp;
+            tmp = tmp->next;
+            delete to_delete;
+        }
+    }
+
+    template <class T>
+    template <class GoPast>
+    typename ConcurrentSortedList<T>::Link *ConcurrentSortedList<T>::lockPredecessor(GoPast go_past)
+    {
+        Link *pred = &this->head;
+        pred->lock.lock();
+        Element *curr = pred->next;
+        while (curr != nullptr)
+        {
+            curr->lock.lock();
+            bool move_on;
+            try
+            {
+                move_on = go_past(curr->data);
+            }
+            catch (...)
+            {
+                curr->lock.unlock();
+                pred->lock.unlock();
+                throw;
+            }
+            if (!move_on)
+            {
+                curr->lock.unlock();
+                break;
+            }
+            pred->lock.unlock();
+            pred = curr;
+            curr = curr->next;
+        }
+        return pred;
+    }
+
+    template <class T>
+    void ConcurrentSortedList<T>::insert(const T &data)
+    {
+        emplace(data);
+    }
+
+    template <class T>
+    template <class... Args>
+    void ConcurrentSortedList<T>::emplace(Args &&...args)
+    {
+        Element *new_element = new Element(std::forward<Args>(args)...);
+        const T &data = new_element->data;
+        Link *pred;
+        try
+        {
+            pred = lockPredecessor([&data](const T &other) { return !(data < other); });
+        }
+        catch (...)
+        {
+            delete new_element;
+            throw;
+        }
+        new_element->next = pred->next;
+        pred->next = new_element;
+        this->size++;
+        pred->lock.unlock();
+    }
+
+    template <class T>
+    bool ConcurrentSortedList<T>::remove(const T &data)
+    {
+        Link *pred = lockPredecessor([&data](const T &other) { return other < data; });
+        Element *to_remove = pred->next;
+        bool found;
+        try
+        {
+            found = to_remove != nullptr && !(data < to_remove->data);
+        }
+        catch (...)
+        {
+            pred->lock.unlock();
+            throw;
+        }
+        if (!found)
+        {
+            pred->lock.unlock();
+            return false;
+        }
+
+        to_remove->lock.lock();
+        pred->next = to_remove->next;
+        this->size--;
+        to_remove->lock.unlock();
+        pred->lock.unlock();
+        delete to_remove;
+        return true;
+    }
+
+    template <class T>
+    bool ConcurrentSortedList<T>::contains(const T &data)
+    {
+        Link *pred = lockPredecessor([&data](const T &other) { return other < data; });
+        Element *candidate = pred->next;
+        bool found;
+        try
+        {
+            found = candidate != nullptr && !(data < candidate->data);
+        }
+        catch (...)
+        {
+            pred->lock.unlock();
+            throw;
+        }
+        pred->lock.unlock();
+        return found;
+    }
+
+    template <class T>
+    int ConcurrentSortedList<T>::length() const
+    {
+        return this->size.load();
+    }
+
+    template <class T>
+    template <class Visit>
+    void ConcurrentSortedList<T>::forEach(Visit visit)
+    {
+        Link *pred = lockPredecessor([&visit](const T &data) {
+            visit(data);
+            return true;
+        });
+        pred->lock.unlock();
+    }
+
+    template <class T>
+    SortedList<T> ConcurrentSortedList<T>::snapshot()
+    {
+        std::vector<T> elements;
+        forEach([&elements](const T &data) { elements.push_back(data); });
+        return SortedList<T>(std::make_move_iterator(elements.begin()), std::make_move_iterator(elements.end()));
+    }
+}
+#endif
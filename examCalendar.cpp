@@ -0,0 +1,132 @@
+#include "examCalendar.h"
+
+#include <stdexcept>
+
+namespace mtm
+{
+    ExamCalendar::ExamCalendar(const SortedList<ExamDetails> &exams) : exams(exams)
+    {
+        rebuildIndex();
+    }
+
+    ExamCalendar::ExamCalendar(const ExamCalendar &calendar) : exams(calendar.exams)
+    {
+        rebuildIndex();
+    }
+
+    ExamCalendar &ExamCalendar::operator=(const ExamCalendar &calendar)
+    {
+        if (this == &calendar)
+        {
+            return *this;
+        }
+        this->exams = calendar.exams;
+        rebuildIndex();
+        return *this;
+    }
+
+    void ExamCalendar::rebuildIndex()
+    {
+        this->index.clear();
+        this->index.reserve((std::size_t)this->exams.length());
+        for (const_iterator it = this->exams.begin(); !(it == this->exams.end()); ++it)
+        {
+            if (!this->index.insert(std::make_pair((*it).getCourseId(), it)).second)
+            {
+                this->index.clear();
+                throw std::runtime_error(duplicate_course_error);
+            }
+        }
+    }
+
+    bool ExamCalendar::insert(const ExamDetails &exam)
+    {
+        if (this->index.count(exam.getCourseId()) != 0)
+        {
+            return false;
+        }
+        const_iterator it = this->exams.insert(exam);
+        try
+        {
+            this->index.insert(std::make_pair(exam.getCourseId(), it));
+        }
+        catch (...)
+        {
+            this->exams.remove(it);
+            throw;
+        }
+        return true;
+    }
+
+    ExamCalendar::const_iterator ExamCalendar::find(const int course_id) const
+    {
+        std::unordered_map<int, const_iterator>::const_iterator found = this->index.find(course_id);
+        if (found == this->index.end())
+        {
+            return this->exams.end();
+        }
+        return found->second;
+    }
+
+    bool ExamCalendar::contains(const int course_id) const
+    {
+        return this->index.count(course_id) != 0;
+    }
+
+    bool ExamCalendar::setLink(const int course_id, const std::string &new_link)
+    {
+        std::unordered_map<int, const_iterator>::const_iterator found = this->index.find(course_id);
+        if (found == this->index.end())
+        {
+            return false;
+        }
+        // the link isn't part of the order, so the exam stays where it is.
+        this->exams.modify(found->second, [&new_link](ExamDetails &exam) { exam.setLink(new_link); });
+        return true;
+    }
+
+    bool ExamCalendar::reschedule(const int course_id, const int month, const int day, const double hour)
+    {
+        std::unordered_map<int, const_iterator>::const_iterator found = this->index.find(course_id);
+        if (found == this->index.end())
+        {
+            return false;
+        }
+        const ExamDetails &exam = *found->second;
+        ExamDetails moved(course_id, month, day, hour, exam.getDuration(), exam.getLink());
+        this->exams.modify(found->second, [&moved](ExamDetails &old_exam) { old_exam = moved; });
+        return true;
+    }
+
+    bool ExamCalendar::remove(const int course_id)
+    {
+        std::unordered_map<int, const_iterator>::const_iterator found = this->index.find(course_id);
+        if (found == this->index.end())
+        {
+            return false;
+        }
+        this->exams.remove(found->second);
+        this->index.erase(found);
+        return true;
+    }
+
+    int ExamCalendar::length() const
+    {
+        return this->exams.length();
+    }
+
+    ExamCalendar::const_iterator ExamCalendar::begin() const
+    {
+        return this->exams.begin();
+    }
+
+    ExamCalendar::const_iterator ExamCalendar::end() const
+    {
+        return this->exams.end();
+    }
+
+    const SortedList<ExamDetails> &ExamCalendar::getList() const
+    {
+        return this->exams;
+    }
+}
@@ -0,0 +1,151 @@
+#ifndef EXAM_CALENDAR_H
+#define EXAM_CALENDAR_H
+
+#include <string>
+#include <unordered_map>
+
+#include "examDetails.h"
+#include "sortedList.h"
+
+namespace mtm
+{
+    static const std::string duplicate_course_error = "course already in calendar";
+
+    /*
+     * ExamCalendar holds at most one exam per course, in date order like SortedList<ExamDetails>, together with a
+     * hash index from course id to the node of its exam. Finding, updating and removing the exam of a course take
+     * O(1) expected time instead of a walk over the calendar; inserting still takes O(log n).
+     * The index holds iterators of the list, which stay valid as long as their exams are in it - every change goes
+     * through the calendar, so the two never disagree.
+     */
+    class ExamCalendar
+    {
+        SortedList<ExamDetails> exams;
+        std::unordered_map<int, SortedList<ExamDetails>::const_iterator> index;
+
+        /**
+         * @brief Builds the index from scratch over the exams of the list.
+         * @return (void)
+         * @possible_Exceptions - std::runtime_error - if two exams of the list belong to the same course.
+         */
+        void rebuildIndex();
+
+    public:
+        typedef SortedList<ExamDetails>::const_iterator const_iterator;
+
+        /**
+         * @brief Constructs a new empty calendar.
+         */
+        ExamCalendar() = default;
+
+        /**
+         * @brief Constructs a calendar with the exams of a list, in O(n).
+         * @param exams - exams of the calendar.
+         * @possible_Exceptions - std::runtime_error - if two exams of the list belong to the same course.
+         */
+        explicit ExamCalendar(const SortedList<ExamDetails> &exams);
+
+        /**
+         * @brief Constructs a copy of a calendar, with an index of its own.
+         * @param calendar - calendar to copy.
+         */
+        ExamCalendar(const ExamCalendar &calendar);
+
+        /**
+         * @brief Replaces the exams of this calendar with a copy of the exams of another one.
+         * @param calendar - calendar to copy.
+         * @return this after it has changed.
+         */
+        ExamCalendar &operator=(const ExamCalendar &calendar);
+
+        ~ExamCalendar() = default;
+
+        /**
+         * @brief Adds the exam of a course that isn't in the calendar yet, in O(log n) expected time.
+         * @param exam - exam to add.
+         * @return true - if the exam was added, false - if its course already has an exam in the calendar.
+         */
+        bool insert(const ExamDetails &exam);
+
+        /**
+         * @brief Finds the exam of a course, in O(1) expected time.
+         * @param course_id - course to look for.
+         * @return iterator to the exam, or end() if the course has no exam in the calendar.
+         */
+        const_iterator find(const int course_id) const;
+
+        /**
+         * @brief contains
+         * @param course_id - course to look for.
+         * @return true - if the course has an exam in the calendar, false - otherwise.
+         */
+        bool contains(const int course_id) const;
+
+        /**
+         * @brief Changes the zoom link of the exam of a course in place, in O(1) expected time.
+         * @param course_id - course of the exam.
+         * @param new_link - the new zoom link.
+         * @return true - if the link was changed, false - if the course has no exam in the calendar.
+         */
+        bool setLink(const int course_id, const std::string &new_link);
+
+        /**
+         * @brief Moves the exam of a course to another date and start hour, keeping its duration and link.
+         * The node of the exam is moved in O(log n) expected time, iterators to it stay valid.
+         * @param course_id - course of the exam.
+         * @param month - new exam month
+         * @param day - new exam day
+         * @param hour - new exam start hour
+         * @return true - if the exam was moved, false - if the course has no exam in the calendar.
+         * @possible_Exceptions - ExamDetails::InvalidDateException, ExamDetails::InvalidTimeException - like the
+         * constructor of ExamDetails, the calendar doesn't change.
+         */
+        bool reschedule(const int course_id, const int month, const int day, const double hour);
+
+        /**
+         * @brief Removes the exam of a course, in O(1) expected time.
+         * @param course_id - course of the exam.
+         * @return true - if an exam was removed, false - if the course has no exam in the calendar.
+         */
+        bool remove(const int course_id);
+
+        /**
+         * @brief Removes every exam that fulfills a condition, e.g. the exams that already took place, in a single
+         * pass over the calendar.
+         * @param c A boolian condition, the exams that return true with it are removed.
+         * @return The number of exams removed.
+         */
+        template <class Condition>
+        int removeIf(Condition c);
+
+        /**
+         * @brief Length
+         * @return Returns the number of exams in the calendar.
+         */
+        int length() const;
+
+        const_iterator begin() const;
+        const_iterator end() const;
+
+        /**
+         * @brief getList
+         * @return The exams of the calendar in date order, e.g. for ExamWriter or ExamConflicts.
+         */
+        const SortedList<ExamDetails> &getList() const;
+    };
+
+    template <class Condition>
+    int ExamCalendar::removeIf(Condition c)
+    {
+        std::unordered_map<int, const_iterator> &index = this->index;
+        return this->exams.removeIf([&index, &c](const ExamDetails &exam) {
+            if (!c(exam))
+            {
+                return false;
+            }
+            index.erase(exam.getCourseId());
+            return true;
+        });
+    }
+}
+#endif
@@ -0,0 +1,23 @@
+#include "examConflicts.h"
+
+namespace mtm
+{
+    std::vector<ExamConflicts::Conflict> ExamConflicts::findOverlaps(const SortedList<ExamDetails> &calendar)
+    {
+        std::vector<Conflict> conflicts;
+        forEachOverlap(calendar, [&conflicts](const ExamDetails &earlier, const ExamDetails &later) {
+            conflicts.push_back(Conflict(&earlier, &later));
+        });
+        return conflicts;
+    }
+
+    std::vector<ExamConflicts::Conflict> ExamConflicts::findClosePairs(const SortedList<ExamDetails> &calendar,
+                                                                       const int days)
+    {
+        std::vector<Conflict> conflicts;
+        forEachClosePair(calendar, days, [&conflicts](const ExamDetails &earlier, const ExamDetails &later) {
+            conflicts.push_back(Conflict(&earlier, &later));
+        });
+        return conflicts;
+    }
+}
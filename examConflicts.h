@@ -0,0 +1,134 @@
+#ifndef EXAM_CONFLICTS_H
+#define EXAM_CONFLICTS_H
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "examDetails.h"
+#include "sortedList.h"
+
+namespace mtm
+{
+    /*
+     * ExamConflicts finds exams of a calendar that clash, using the order of the calendar instead of checking every
+     * pair. Two exams overlap when each of them starts before the other one ends. Starts are counted in half hours
+     * from the beginning of the year, which is exactly the sort key of an exam.
+     * Every query runs in O(n log n + number of pairs found) and reports each pair once, as (earlier, later),
+     * grouped by the later exam in calendar order. The pointers point into the calendar and stay valid as long as
+     * the exams stay in it.
+     */
+    class ExamConflicts
+    {
+        /**
+         * @brief end of an exam, in half hours from the beginning of the year.
+         * @param exam - exam to check.
+         * @return the half hour right after the exam ends.
+         */
+        static long endOf(const ExamDetails &exam);
+
+        /**
+         * @brief Orders exams by their end, latest first, making a heap keep the exam that ends first at its top.
+         */
+        class EndsLater
+        {
+        public:
+            bool operator()(const ExamDetails *first, const ExamDetails *second) const
+            {
+                return endOf(*first) > endOf(*second);
+            }
+        };
+
+    public:
+        typedef std::pair<const ExamDetails *, const ExamDetails *> Conflict;
+
+        /**
+         * @brief Calls visit with every pair of exams whose hours overlap.
+         * A sweep over the calendar keeps a heap of the exams still running, ordered by their end.
+         * @param calendar - calendar to check.
+         * @param visit - called with the earlier and the later exam of every overlapping pair.
+         * @return (void)
+         */
+        template <class Visit>
+        static void forEachOverlap(const SortedList<ExamDetails> &calendar, Visit visit);
+
+        /**
+         * @brief Calls visit with every pair of exams whose days are less than days apart (see operator-).
+         * Two pointers keep a window of the exams less than days before the current one.
+         * @param calendar - calendar to check.
+         * @param days - number of days, pairs of exams this many days apart or more are not reported.
+         * @param visit - called with the earlier and the later exam of every close pair.
+         * @return (void)
+         */
+        template <class Visit>
+        static void forEachClosePair(const SortedList<ExamDetails> &calendar, const int days, Visit visit);
+
+        /**
+         * @brief Finds all the pairs of exams whose hours overlap, see forEachOverlap.
+         * @param calendar - calendar to check.
+         * @return The overlapping pairs.
+         */
+        static std::vector<Conflict> findOverlaps(const SortedList<ExamDetails> &calendar);
+
+        /**
+         * @brief Finds all the pairs of exams that are less than days apart, see forEachClosePair.
+         * @param calendar - calendar to check.
+         * @param days - number of days, pairs of exams this many days apart or more are not reported.
+         * @return The close pairs.
+         */
+        static std::vector<Conflict> findClosePairs(const SortedList<ExamDetails> &calendar, const int days);
+    };
+
+    inline long ExamConflicts::endOf(const ExamDetails &exam)
+    {
+        return exam.getSortKey() + 2L * exam.getDuration();
+    }
+
+    template <class Visit>
+    void ExamConflicts::forEachOverlap(const SortedList<ExamDetails> &calendar, Visit visit)
+    {
+        std::vector<const ExamDetails *> running;
+        for (SortedList<ExamDetails>::const_iterator it = calendar.begin(); !(it == calendar.end()); ++it)
+        {
+            const ExamDetails &exam = *it;
+            while (!running.empty() && endOf(*running.front()) <= exam.getSortKey())
+            {
+                std::pop_heap(running.begin(), running.end(), EndsLater());
+                running.pop_back();
+            }
+            for (typename std::vector<const ExamDetails *>::const_iterator other = running.begin();
+                 other != running.end(); ++other)
+            {
+                // an exam of no duration doesn't clash with the exams that start with it.
+                if (exam.getDuration() > 0 || (*other)->getSortKey() < exam.getSortKey())
+                {
+                    visit(**other, exam);
+                }
+            }
+            if (exam.getDuration() == 0)
+            {
+                continue;
+            }
+            running.push_back(&exam);
+            std::push_heap(running.begin(), running.end(), EndsLater());
+        }
+    }
+
+    template <class Visit>
+    void ExamConflicts::forEachClosePair(const SortedList<ExamDetails> &calendar, const int days, Visit visit)
+    {
+        SortedList<ExamDetails>::const_iterator window_start = calendar.begin();
+        for (SortedList<ExamDetails>::const_iterator it = calendar.begin(); !(it == calendar.end()); ++it)
+        {
+            while (!(window_start == it) && *it - *window_start >= days)
+            {
+                ++window_start;
+            }
+            for (SortedList<ExamDetails>::const_iterator other = window_start; !(other == it); ++other)
+            {
+                visit(*other, *it);
+            }
+        }
+    }
+}
+#endif
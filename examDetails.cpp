@@ -1,5 +1,9 @@
 #include "examDetails.h"
 
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+
 namespace mtm
 {
     using std::string;
@@ -17,6 +21,146 @@ namespace mtm
     static constexpr double hour_limit = 23.5;
     static const int bigget_month = 12;
     static const int biggest_day = 30;
+    static const int slots_in_hour = 2;
+    static const int slots_in_day = 48;
+
+    static const std::uint32_t empty_link_id = 0;
+
+    static const std::size_t first_link_segment_size = 256;
+    static const std::size_t link_segment_count = 32;
+
+    /*
+     * The table of interned zoom links. Links are never removed or moved, so a reference to an interned link stays
+     * valid as long as the program runs. The links live in segments that double in size and are never reallocated,
+     * and the number of links is published with a release store after a link is written, so reading a link takes no
+     * lock - only internLink locks the table. The table is created on first use, so exams may be constructed during
+     * static initialization.
+     */
+    class LinkTable
+    {
+    public:
+        std::mutex lock;
+        string *segments[link_segment_count];
+        std::atomic<std::uint32_t> count;
+        std::unordered_map<string, std::uint32_t> ids;
+
+        LinkTable() : count(0)
+        {
+            for (std::size_t i = 0; i < link_segment_count; i++)
+            {
+                this->segments[i] = nullptr;
+            }
+            append(empty_link);
+        }
+
+        LinkTable(const LinkTable &table) = delete;
+        LinkTable &operator=(const LinkTable &table) = delete;
+
+        ~LinkTable()
+        {
+            for (std::size_t i = 0; i < link_segment_count; i++)
+            {
+                delete[] this->segments[i];
+            }
+        }
+
+        /**
+         * @brief Finds where a link is kept in the segments.
+         * @param link_id - handle of the link.
+         * @param offset - position of the link in its segment.
+         * @return index of the segment of the link, which may not be allocated yet.
+         */
+        static std::size_t segmentOf(const std::uint32_t link_id, std::size_t &offset)
+        {
+            std::uint64_t position = (std::uint64_t)link_id + first_link_segment_size;
+            std::size_t segment = 0;
+            while (position >= (std::uint64_t)first_link_segment_size << (segment + 1))
+            {
+                segment++;
+            }
+            offset = (std::size_t)(position - ((std::uint64_t)first_link_segment_size << segment));
+            return segment;
+        }
+
+        /**
+         * @brief Adds a link to the table. The caller holds the lock, except while the table is constructed.
+         * @param link - the link to add.
+         * @return the handle of the link.
+         */
+        std::uint32_t append(const string &link)
+        {
+            std::uint32_t id = this->count.load(std::memory_order_relaxed);
+            std::size_t offset;
+            std::size_t segment = segmentOf(id, offset);
+            if (this->segments[segment] == nullptr)
+            {
+                this->segments[segment] = new string[first_link_segment_size << segment];
+            }
+            this->segments[segment][offset] = link;
+            this->ids[link] = id;
+            this->count.store(id + 1, std::memory_order_release);
+            return id;
+        }
+
+        /**
+         * @brief Finds a link without locking the table.
+         * @param link_id - handle returned by append.
+         * @return the link.
+         */
+        const string &at(const std::uint32_t link_id)
+        {
+            // pairs with the release store of append, so the link and its segment are visible.
+            if (link_id >= this->count.load(std::memory_order_acquire))
+            {
+                return empty_link;
+            }
+            std::size_t offset;
+            std::size_t segment = segmentOf(link_id, offset);
+            return this->segments[segment][offset];
+        }
+    };
+
+    static LinkTable &linkTable()
+    {
+        static LinkTable table;
+        return table;
+    }
+
+    /**
+     * internLink - finds the handle of a link, adding the link to the table if it isn't there yet.
+     * @param link - the link to intern.
+     * @return the handle of the link.
+     */
+    static std::uint32_t internLink(const string &link)
+    {
+        if (link.empty())
+        {
+            return empty_link_id;
+        }
+
+        LinkTable &table = linkTable();
+        std::lock_guard<std::mutex> guard(table.lock);
+        std::unordered_map<string, std::uint32_t>::const_iterator found = table.ids.find(link);
+        if (found != table.ids.end())
+        {
+            return found->second;
+        }
+        return table.append(link);
+    }
+
+    /**
+     * linkOf - finds the link of a handle, without taking the lock of the table.
+     * @param link_id - handle returned by internLink.
+     * @return the interned link.
+     */
+    static const string &linkOf(const std::uint32_t link_id)
+    {
+        if (link_id == empty_link_id)
+        {
+            return empty_link;
+        }
+        return linkTable().at(link_id);
+    }
 
     /**
      * roundedNum - rounds the number up or down according to to which side it closest to.
@@ -57,6 +201,12 @@ namespace mtm
      */
     static bool checkIsHourValid(const double hour)
     {
+        // NaN fails every comparison below, so it has to be rejected on its own.
+        if (!std::isfinite(hour))
+        {
+            return false;
+        }
+
         int int_part_hour = roundedNum(hour);
         if (hour < -epsilon || hour - hour_limit > epsilon)
         {
@@ -72,7 +222,7 @@ namespace mtm
     }
 
     ExamDetails::ExamDetails(const int course_id, const int month, const int day,
-                             const double hour, const int duration, const string link_to_zoom)
+                             const double hour, const int duration, const string &link_to_zoom)
     {
 
         if (checkIsDateValid(month, day) == false)
@@ -91,80 +241,152 @@ namespace mtm
         }
 
         this->course_id = course_id;
-        this->month = month;
-        this->day = day;
-        this->hour = hour;
+        int day_of_year = (month - 1) * days_in_month + (day - 1);
+        int slot = (int)std::lround(hour * slots_in_hour);
+        this->sort_key = (std::uint16_t)(day_of_year * slots_in_day + slot);
         this->duration = duration;
-        this->link_to_zoom = link_to_zoom;
+        this->link_id = internLink(link_to_zoom);
+    }
+
+    ExamDetails::ExamDetails(const int course_id, const std::uint16_t sort_key, const int duration,
+                             const std::uint32_t link_id)
+        : course_id(course_id), duration(duration), link_id(link_id), sort_key(sort_key)
+    {
     }
 
     ExamDetails ExamDetails::makeMatamExam()
     {
         int course_id = mtm_course_id, month = mtm_month, day = mtm_day, duration = mtm_exam_duration;
         double hour = mtm_exam_start;
-        string link = mtm_link;
-        ExamDetails matam_exam(course_id, month, day, hour, duration, link);
+        ExamDetails matam_exam(course_id, month, day, hour, duration, mtm_link);
 
         return matam_exam;
     }
 
+    bool ExamDetails::isDateValid(const int month, const int day)
+    {
+        return checkIsDateValid(month, day);
+    }
+
+    bool ExamDetails::isTimeValid(const double hour)
+    {
+        return checkIsHourValid(hour);
+    }
+
     int ExamDetails::operator-(const ExamDetails &other_exam) const
     {
-        int number_of_days = (this->month - other_exam.month) * days_in_month;
-        number_of_days += this->day - other_exam.day;
-        return number_of_days;
+        return this->sort_key / slots_in_day - other_exam.sort_key / slots_in_day;
     }
 
     bool ExamDetails::operator<(const ExamDetails &other_exam) const
     {
-        int days_diff = *this - other_exam;
-        if (days_diff < 0)
+        return this->sort_key < other_exam.sort_key;
+    }
+
+    std::ostream &operator<<(std::ostream &os, const ExamDetails &exam_details)
+    {
+        int day_of_year = exam_details.sort_key / slots_in_day, slot = exam_details.sort_key % slots_in_day;
+        string minutes = slot % slots_in_hour == 0 ? round_hour : half_hour;
+
+        os << "Course Number: " << exam_details.course_id << std::endl;
+        os << "Time: " << day_of_year % days_in_month + 1 << "." << day_of_year / days_in_month + 1 << " at "
+           << slot / slots_in_hour << minutes << std::endl;
+        os << "Duration: " << exam_details.duration << round_hour << std::endl;
+        os << "Zoom Link: " << linkOf(exam_details.link_id) << std::endl;
+
+        return os;
+    }
+
+    /**
+     * appendInt - appends the decimal digits of a number to a buffer.
+     * @param buffer - buffer the digits are appended to.
+     * @param value - number to append.
+     * @return (void)
+     */
+    static void appendInt(string &buffer, const int value)
+    {
+        char digits[12];
+        char *start = digits + sizeof(digits);
+        unsigned int rest = value < 0 ? 0u - (unsigned int)value : (unsigned int)value;
+        do
         {
-            return true;
-        }
-        else if (days_diff > 0)
+            *--start = (char)('0' + rest % 10);
+            rest /= 10;
+        } while (rest != 0);
+        if (value < 0)
         {
-            return false;
+            *--start = '-';
         }
+        buffer.append(start, digits + sizeof(digits));
+    }
 
-        if (this->hour >= other_exam.hour)
-        {
-            return false;
-        }
+    void formatTo(string &buffer, const ExamDetails &exam_details)
+    {
+        int day_of_year = exam_details.sort_key / slots_in_day, slot = exam_details.sort_key % slots_in_day;
 
-        if (other_exam.hour - this->hour < epsilon)
-        {
-            return false;
-        }
-        return true;
+        buffer.append("Course Number: ");
+        appendInt(buffer, exam_details.course_id);
+        buffer.append("\nTime: ");
+        appendInt(buffer, day_of_year % days_in_month + 1);
+        buffer.push_back('.');
+        appendInt(buffer, day_of_year / days_in_month + 1);
+        buffer.append(" at ");
+        appendInt(buffer, slot / slots_in_hour);
+        buffer.append(slot % slots_in_hour == 0 ? round_hour : half_hour);
+        buffer.append("\nDuration: ");
+        appendInt(buffer, exam_details.duration);
+        buffer.append(round_hour);
+        buffer.append("\nZoom Link: ");
+        buffer.append(linkOf(exam_details.link_id));
+        buffer.push_back('\n');
     }
 
-    std::ostream &operator<<(std::ostream &os, const ExamDetails &exam_details)
+    ExamDetails ExamDetails::fromSortKey(const int course_id, const int sort_key, const int duration,
+                                         const string &link_to_zoom)
     {
-        string minutes = round_hour;
-        double fraction, hour_int_part = 0;
-        fraction = std::modf(exam_details.hour, &hour_int_part);
-        if (fabs(fraction - half) < epsilon)
+        if (sort_key < 0 || sort_key >= exam_sort_key_limit)
         {
-            minutes = half_hour;
+            throw ExamDetails::InvalidDateException();
         }
 
-        os << "Course Number: " << exam_details.course_id << std::endl;
-        os << "Time: " << exam_details.day << "." << exam_details.month << " at " << roundedNum(exam_details.hour)
-           << minutes << std::endl;
-        os << "Duration: " << exam_details.duration << round_hour << std::endl;
-        os << "Zoom Link: " << exam_details.link_to_zoom << std::endl;
+        int day_of_year = sort_key / slots_in_day, slot = sort_key % slots_in_day;
+        return ExamDetails(course_id, day_of_year / days_in_month + 1, day_of_year % days_in_month + 1,
+                           (double)slot / slots_in_hour, duration, link_to_zoom);
+    }
 
-        return os;
+    std::uint32_t ExamDetails::linkHandle(const string &link_to_zoom)
+    {
+        return internLink(link_to_zoom);
+    }
+
+    ExamDetails ExamDetails::fromLinkHandle(const int course_id, const int sort_key, const int duration,
+                                            const std::uint32_t link_handle)
+    {
+        return ExamDetails(course_id, (std::uint16_t)sort_key, duration, link_handle);
+    }
+
+    int ExamDetails::getSortKey() const
+    {
+        return this->sort_key;
+    }
+
+    int ExamDetails::getCourseId() const
+    {
+        return this->course_id;
+    }
+
+    int ExamDetails::getDuration() const
+    {
+        return this->duration;
     }
 
-    string ExamDetails::getLink() const
+    const string &ExamDetails::getLink() const
     {
-        return this->link_to_zoom;
+        return linkOf(this->link_id);
     }
 
-    void ExamDetails::setLink(const string new_link)
+    void ExamDetails::setLink(const string &new_link)
     {
-        this->link_to_zoom = new_link;
+        this->link_id = internLink(new_link);
     }
 }
@@ -4,16 +4,40 @@
 #include <cstdio> 
 #include <cstdlib>
 #include <cmath>
+#include <cstdint>
 
 #include <iostream>
+#include <string>
+
+#include "snapshotTraits.h"
+#include "sortKey.h"
 namespace mtm
 {
     static const std::string empty_link = "";
+    static const int exam_sort_key_limit = 12 * 30 * 48;
     class ExamDetails
     {
-        int course_id, month, day, duration;
-        double hour;   
-        std::string link_to_zoom;
+        int course_id, duration;
+        /*
+         * handle of the zoom link in the table of interned links - every distinct link is stored once, no matter
+         * how many exams (or copies of exams) use it.
+         */
+        std::uint32_t link_id;
+        /*
+         * date and start time packed into one number: (day of year * 48 + half hour slot of the day), where the
+         * day of year counts 30 days per month. Ordering exams compares this single integer.
+         */
+        std::uint16_t sort_key;
+
+        /**
+         * @brief Constructs an exam from its stored fields, without checking them.
+         * @param course_id - Course's Id
+         * @param sort_key - key returned by getSortKey
+         * @param duration - Course's exam duration
+         * @param link_id - handle of the exam's zoom link
+         */
+        ExamDetails(const int course_id, const std::uint16_t sort_key, const int duration,
+                    const std::uint32_t link_id);
 
     public:
         /**
@@ -26,7 +50,7 @@ namespace mtm
          * @param link_to_zoom - Course's exam zoom link
          */
         ExamDetails(const int course_id, const int month, const int day, const double hour,
-                    const int duration, const std::string link_to_zoom = empty_link);
+                    const int duration, const std::string &link_to_zoom = empty_link);
 
         /**
         * Copy Constractor - default function.
@@ -46,6 +70,52 @@ namespace mtm
          */
         static ExamDetails makeMatamExam();
 
+        /**
+         * @brief Checks a date the way the constructor does, without throwing.
+         * @param month - exam month
+         * @param day - exam day
+         * @return true - if the constructor accepts the date, false - if it throws InvalidDateException.
+         */
+        static bool isDateValid(const int month, const int day);
+
+        /**
+         * @brief Checks a start hour the way the constructor does, without throwing.
+         * @param hour - exam start hour
+         * @return true - if the constructor accepts the hour, false - if it throws InvalidTimeException.
+         */
+        static bool isTimeValid(const double hour);
+
+        /**
+         * @brief Constructs an exam from its sort key instead of its date and hour - the inverse of getSortKey.
+         * @param course_id - Course's Id
+         * @param sort_key - key returned by getSortKey
+         * @param duration - Course's exam duration
+         * @param link_to_zoom - Course's exam zoom link
+         * @return An exam with the date and start hour the key stands for.
+         */
+        static ExamDetails fromSortKey(const int course_id, const int sort_key, const int duration,
+                                       const std::string &link_to_zoom = empty_link);
+
+        /**
+         * @brief Interns a zoom link once, so that many exams can be built with it by fromLinkHandle without
+         * looking the link up again.
+         * @param link_to_zoom - the zoom link.
+         * @return handle of the link, valid for as long as the program runs.
+         */
+        static std::uint32_t linkHandle(const std::string &link_to_zoom);
+
+        /**
+         * @brief Builds an exam from fields that were already checked, e.g. a stored record, in O(1) - nothing is
+         * validated and no link is interned.
+         * @param course_id - Course's Id
+         * @param sort_key - key returned by getSortKey, must be in [0, exam_sort_key_limit).
+         * @param duration - Course's exam duration, must not be negative.
+         * @param link_handle - handle returned by linkHandle.
+         * @return An exam with the given fields.
+         */
+        static ExamDetails fromLinkHandle(const int course_id, const int sort_key, const int duration,
+                                          const std::uint32_t link_handle);
+
         /**
         * operator= - default function.
         * @brief delelt the existing exam and constructs a copy of the exam that given as parameter.
@@ -77,18 +147,46 @@ namespace mtm
          */
         friend std::ostream &operator<<(std::ostream &os, const ExamDetails &exam_details);
 
+        /**
+         * @brief Appends the output of operator<< for an exam to a buffer, byte for byte, without any stream or
+         * flush - the buffer may be reused for many exams and written out at once.
+         * @param buffer - buffer the output is appended to.
+         * @param exam_details - exam we want to print out.
+         * @return (void)
+         */
+        friend void formatTo(std::string &buffer, const ExamDetails &exam_details);
+
+        /**
+         * getSortKey
+         * @return The exam's ordering key - (day of year * 48 + half hour slot of the start time), where the day
+         * of year counts 30 days per month. a < b exactly when a.getSortKey() < b.getSortKey().
+         */
+        int getSortKey() const;
+
+        /**
+         * getCourseId
+         * @return Exam's course id.
+         */
+        int getCourseId() const;
+
+        /**
+         * getDuration
+         * @return Exam's duration in hours.
+         */
+        int getDuration() const;
+
         /**
          * getLink  
-         * @return Exam's zoom link.
+         * @return Exam's zoom link, stored in the table of interned links for as long as the program runs.
          */
-        std::string getLink() const;
+        const std::string &getLink() const;
         
         /**
          * setLink - update the Exam link with @param new_link
          * @param new_link - the new zoom link.
          * @return void.
          */
-        void setLink(const std::string new_link);
+        void setLink(const std::string &new_link);
         
         
         class InvalidDateException
@@ -101,5 +199,44 @@ namespace mtm
         {
         };
     };
+
+    /*
+     * Lets SortedList sort bulk input of exams by their sort key, with a counting sort.
+     */
+    template <>
+    class SortKeyTraits<ExamDetails>
+    {
+    public:
+        static const bool has_key = true;
+        static const int key_limit = exam_sort_key_limit;
+        static int key(const ExamDetails &exam) { return exam.getSortKey(); }
+    };
+
+    /*
+     * Keys for keeping exams in other orders, e.g. SortedList<ExamDetails, std::less<int>, ExamCourseKey> is a
+     * list of exams ordered by course.
+     */
+    class ExamCourseKey
+    {
+    public:
+        int operator()(const ExamDetails &exam) const { return exam.getCourseId(); }
+    };
+
+    class ExamDurationKey
+    {
+    public:
+        int operator()(const ExamDetails &exam) const { return exam.getDuration(); }
+    };
+
+    /*
+     * An exam holds a handle of its link, which means nothing in another process, so its raw bytes can't be
+     * stored or mapped - SortedList<ExamDetails> is stored with the functions of examStorage.h.
+     */
+    template <>
+    class SnapshotTraits<ExamDetails>
+    {
+    public:
+        static const bool mappable = false;
+    };
 }
 #endif
\ No newline at end of file
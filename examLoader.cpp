@@ -0,0 +1,168 @@
+#include "examLoader.h"
+
+#include <cctype>
+#include <cerrno>
+#include <climits>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+
+namespace mtm
+{
+    using std::string;
+    static const string malformed_record_error = "malformed record";
+    static const string invalid_date_error = "invalid date";
+    static const string invalid_time_error = "invalid time";
+    static const string invalid_args_error = "invalid arguments";
+    static const string open_file_error = "can't open file";
+    static const char field_separator = ',';
+    static const char comment_mark = '#';
+
+    /**
+     * parseInt - reads an integer field and the separator after it.
+     * @param cursor - position of the field, moved past the separator.
+     * @param value - the integer read.
+     * @param may_end_line - true - the line may end right after the field, false - a separator must follow.
+     * @return true - if the field is a valid int followed by a separator, false - otherwise.
+     */
+    static bool parseInt(const char *&cursor, int &value, const bool may_end_line = false)
+    {
+        char *end;
+        errno = 0;
+        long result = std::strtol(cursor, &end, 10);
+        if (end == cursor || errno != 0 || result < INT_MIN || result > INT_MAX)
+        {
+            return false;
+        }
+        if (*end != field_separator && !(may_end_line && *end == '\0'))
+        {
+            return false;
+        }
+        value = (int)result;
+        cursor = *end == '\0' ? end : end + 1;
+        return true;
+    }
+
+    /**
+     * parseDouble - reads a floating point field and the separator after it.
+     * @param cursor - position of the field, moved past the separator.
+     * @param value - the number read.
+     * @return true - if the field is a finite number followed by a separator, false - otherwise (strtod also
+     * accepts "nan" and "inf").
+     */
+    static bool parseDouble(const char *&cursor, double &value)
+    {
+        char *end;
+        errno = 0;
+        double result = std::strtod(cursor, &end);
+        if (end == cursor || errno != 0 || *end != field_separator || !std::isfinite(result))
+        {
+            return false;
+        }
+        value = result;
+        cursor = end + 1;
+        return true;
+    }
+
+    /**
+     * parseLine - validates one CSV line and adds its exam to the batch, or an error to the report.
+     * @param line - the line, without the line break.
+     * @param line_number - number of the line in the input, starting from 1.
+     * @param batch - exams read so far.
+     * @param report - report of the load.
+     * @return (void)
+     */
+    static void parseLine(const string &line, const int line_number, std::vector<ExamDetails> &batch,
+                          ExamLoader::Report &report)
+    {
+        if (line.empty() || line[0] == comment_mark)
+        {
+            return;
+        }
+        if (line_number == 1 && std::isalpha((unsigned char)line[0]))
+        {
+            return;
+        }
+
+        report.rows_read++;
+        const char *cursor = line.c_str();
+        int course_id, month, day, duration;
+        double hour;
+        if (!parseInt(cursor, course_id) || !parseInt(cursor, month) || !parseInt(cursor, day) ||
+            !parseDouble(cursor, hour) || !parseInt(cursor, duration, true))
+        {
+            report.errors.push_back(ExamLoader::Error(line_number, malformed_record_error));
+            return;
+        }
+        if (!ExamDetails::isDateValid(month, day))
+        {
+            report.errors.push_back(ExamLoader::Error(line_number, invalid_date_error));
+            return;
+        }
+        if (!ExamDetails::isTimeValid(hour))
+        {
+            report.errors.push_back(ExamLoader::Error(line_number, invalid_time_error));
+            return;
+        }
+        if (duration < 0)
+        {
+            report.errors.push_back(ExamLoader::Error(line_number, invalid_args_error));
+            return;
+        }
+
+        batch.push_back(ExamDetails(course_id, month, day, hour, duration, string(cursor)));
+    }
+
+    ExamLoader::Report ExamLoader::load(std::istream &input, SortedList<ExamDetails> &calendar,
+                                        const std::size_t chunk_size)
+    {
+        Report report;
+        std::vector<ExamDetails> batch;
+        std::vector<char> buffer(chunk_size == 0 ? 1 : chunk_size);
+        string line;
+        int line_number = 1;
+
+        while (input.read(buffer.data(), buffer.size()) || input.gcount() > 0)
+        {
+            const char *chunk = buffer.data(), *chunk_end = chunk + input.gcount();
+            const char *line_start = chunk;
+            for (const char *it = chunk; it != chunk_end; ++it)
+            {
+                if (*it != '\n')
+                {
+                    continue;
+                }
+                line.append(line_start, it);
+                if (!line.empty() && line[line.size() - 1] == '\r')
+                {
+                    line.erase(line.size() - 1);
+                }
+                parseLine(line, line_number++, batch, report);
+                line.clear();
+                line_start = it + 1;
+            }
+            line.append(line_start, chunk_end);
+        }
+        if (!line.empty() && line[line.size() - 1] == '\r')
+        {
+            line.erase(line.size() - 1);
+        }
+        parseLine(line, line_number, batch, report);
+
+        calendar.insertRange(std::make_move_iterator(batch.begin()), std::make_move_iterator(batch.end()));
+        report.rows_loaded = (int)batch.size();
+        return report;
+    }
+
+    ExamLoader::Report ExamLoader::loadFile(const string &path, SortedList<ExamDetails> &calendar)
+    {
+        std::ifstream input(path.c_str(), std::ios::in | std::ios::binary);
+        if (!input)
+        {
+            Report report;
+            report.errors.push_back(Error(0, open_file_error));
+            return report;
+        }
+        return load(input, calendar);
+    }
+}
@@ -0,0 +1,69 @@
+#ifndef EXAM_LOADER_H
+#define EXAM_LOADER_H
+
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "examDetails.h"
+#include "sortedList.h"
+
+namespace mtm
+{
+    static const std::size_t default_read_chunk_size = 1 << 20;
+
+    /*
+     * ExamLoader streams exams from CSV text into a SortedList<ExamDetails>.
+     * Every line holds one exam: course_id,month,day,hour,duration,link (the link is the rest of the line and may
+     * be empty). Empty lines and lines starting with '#' are skipped, and so is a first line that starts with a
+     * letter (a header). Bad lines don't stop the load - they are listed in the returned report - and all the
+     * good lines are sorted once and merged into the list together.
+     */
+    class ExamLoader
+    {
+    public:
+        /*
+         * a line that was not loaded and the reason for it.
+         */
+        class Error
+        {
+        public:
+            int line;
+            std::string reason;
+            Error(const int line, const std::string &reason) : line(line), reason(reason) {}
+        };
+
+        /*
+         * summary of a load.
+         */
+        class Report
+        {
+        public:
+            int rows_read;
+            int rows_loaded;
+            std::vector<Error> errors;
+            Report() : rows_read(0), rows_loaded(0) {}
+        };
+
+        /**
+         * @brief Reads exams from a CSV stream and inserts them to calendar.
+         * @param input - stream to read from, read in chunks of chunk_size bytes.
+         * @param calendar - list the exams are inserted to.
+         * @param chunk_size - number of bytes read from the stream at once.
+         * @return A report of the rows read, the rows loaded and the errors.
+         */
+        static Report load(std::istream &input, SortedList<ExamDetails> &calendar,
+                           const std::size_t chunk_size = default_read_chunk_size);
+
+        /**
+         * @brief Reads exams from a CSV file and inserts them to calendar.
+         * @param path - path of the file.
+         * @param calendar - list the exams are inserted to.
+         * @return A report of the rows read, the rows loaded and the errors - one error for line 0 if the file
+         * can't be opened.
+         */
+        static Report loadFile(const std::string &path, SortedList<ExamDetails> &calendar);
+    };
+}
+#endif
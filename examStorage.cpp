@@ -0,0 +1,119 @@
+#include "examStorage.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace mtm
+{
+    using std::string;
+    static const std::uint64_t storage_records_per_read = 4096;
+
+    /*
+     * one stored exam - the link is an index into the link table of the file.
+     */
+    class ExamRecord
+    {
+    public:
+        std::int32_t course_id;
+        std::int32_t duration;
+        std::uint16_t sort_key;
+        std::uint16_t padding;
+        std::uint32_t link_index;
+    };
+
+    void saveSortedList(const SortedList<ExamDetails> &calendar, std::ostream &os)
+    {
+        std::vector<const string *> links;
+        std::unordered_map<string, std::uint32_t> link_indices;
+        std::vector<ExamRecord> records;
+        records.reserve(calendar.length());
+        for (SortedList<ExamDetails>::const_iterator it = calendar.begin(); !(it == calendar.end()); ++it)
+        {
+            const ExamDetails &exam = *it;
+            const string &link = exam.getLink();
+            std::pair<std::unordered_map<string, std::uint32_t>::iterator, bool> found =
+                link_indices.insert(std::make_pair(link, (std::uint32_t)links.size()));
+            if (found.second)
+            {
+                links.push_back(&link);
+            }
+            ExamRecord record;
+            record.course_id = exam.getCourseId();
+            record.duration = exam.getDuration();
+            record.sort_key = (std::uint16_t)exam.getSortKey();
+            record.padding = 0;
+            record.link_index = found.first->second;
+            records.push_back(record);
+        }
+
+        StorageHeader header(sizeof(ExamRecord), records.size(), storage_kind_exams);
+        writeStorage(os, &header, sizeof(header));
+        std::uint32_t link_count = (std::uint32_t)links.size();
+        writeStorage(os, &link_count, sizeof(link_count));
+        for (std::vector<const string *>::const_iterator it = links.begin(); it != links.end(); ++it)
+        {
+            std::uint32_t length = (std::uint32_t)(*it)->size();
+            writeStorage(os, &length, sizeof(length));
+            writeStorage(os, (*it)->data(), length);
+        }
+        if (!records.empty())
+        {
+            writeStorage(os, records.data(), records.size() * sizeof(ExamRecord));
+        }
+    }
+
+    void loadSortedList(std::istream &is, SortedList<ExamDetails> &calendar)
+    {
+        StorageHeader header;
+        readStorage(is, &header, sizeof(header));
+        header.validate(sizeof(ExamRecord), storage_kind_exams);
+
+        std::uint32_t link_count;
+        readStorage(is, &link_count, sizeof(link_count));
+        // every link of the file is interned here once, the records only pick their handles.
+        std::vector<std::uint32_t> link_handles;
+        link_handles.reserve(std::min<std::uint32_t>(link_count, default_storage_reserve));
+        for (std::uint32_t i = 0; i < link_count; i++)
+        {
+            std::uint32_t length;
+            readStorage(is, &length, sizeof(length));
+            string link;
+            // read in pieces, so a corrupt length fails at the end of the stream instead of allocating it all.
+            char piece[4096];
+            while (length > 0)
+            {
+                std::uint32_t piece_size = std::min<std::uint32_t>(length, sizeof(piece));
+                readStorage(is, piece, piece_size);
+                link.append(piece, piece_size);
+                length -= piece_size;
+            }
+            link_handles.push_back(ExamDetails::linkHandle(link));
+        }
+
+        std::vector<ExamDetails> exams;
+        exams.reserve((std::size_t)std::min<std::uint64_t>(header.count, default_storage_reserve));
+        std::vector<ExamRecord> records(std::min<std::uint64_t>(header.count, storage_records_per_read));
+        for (std::uint64_t left = header.count; left > 0;)
+        {
+            std::size_t block_size = (std::size_t)std::min<std::uint64_t>(left, records.size());
+            readStorage(is, records.data(), block_size * sizeof(ExamRecord));
+            for (std::size_t i = 0; i < block_size; i++)
+            {
+                const ExamRecord &record = records[i];
+                if (record.link_index >= link_handles.size() || record.sort_key >= exam_sort_key_limit ||
+                    record.duration < 0)
+                {
+                    throw std::runtime_error(storage_format_error);
+                }
+                exams.push_back(ExamDetails::fromLinkHandle(record.course_id, record.sort_key, record.duration,
+                                                            link_handles[record.link_index]));
+            }
+            left -= block_size;
+        }
+        // a saved calendar is in order, so assign only checks it in one pass and links the exams.
+        calendar.assign(std::make_move_iterator(exams.begin()), std::make_move_iterator(exams.end()));
+    }
+}
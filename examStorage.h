@@ -0,0 +1,40 @@
+#ifndef EXAM_STORAGE_H
+#define EXAM_STORAGE_H
+
+#include <iostream>
+
+#include "examDetails.h"
+#include "sortedList.h"
+#include "sortedListStorage.h"
+
+namespace mtm
+{
+    /*
+     * Binary storage of exam calendars. An exam keeps its link as a handle that only means something in the
+     * process that made it, so the file holds a table of the distinct links followed by one fixed size record per
+     * exam, in the calendar order:
+     *     header (kind = storage_kind_exams) | link count | (length, bytes) per link | records
+     * Loading interns every link of the table once and builds each exam from its record and the handle of its
+     * link, without validating the exam again. The exams are then checked to be in order in one pass and linked
+     * into the list - a file that isn't in order is still loaded, by sorting it.
+     */
+
+    /**
+     * @brief Writes an exam calendar in the binary format above.
+     * @param calendar - calendar to save.
+     * @param os - stream to write to, should be opened in binary mode.
+     * @return (void)
+     * @possible_Exceptions - std::runtime_error - if the stream fails.
+     */
+    void saveSortedList(const SortedList<ExamDetails> &calendar, std::ostream &os);
+
+    /**
+     * @brief Replaces the exams of a calendar with the exams stored by saveSortedList, in O(n).
+     * @param is - stream to read from, should be opened in binary mode.
+     * @param calendar - calendar to load the exams to.
+     * @return (void)
+     * @possible_Exceptions - std::runtime_error - if the stream doesn't hold an exam calendar.
+     */
+    void loadSortedList(std::istream &is, SortedList<ExamDetails> &calendar);
+}
+#endif
@@ -0,0 +1,96 @@
+#include "examWriter.h"
+
+#include <cerrno>
+#include <stdexcept>
+
+#include <unistd.h>
+
+namespace mtm
+{
+    using std::string;
+    static const string write_error = "can't write exams";
+
+    /**
+     * writeAll - writes a whole buffer to a file descriptor, retrying partial and interrupted writes.
+     * @param fd - file descriptor to write to.
+     * @param buffer - bytes to write.
+     * @return (void)
+     * @possible_Exceptions - std::runtime_error - if writing fails.
+     */
+    static void writeAll(const int fd, const string &buffer)
+    {
+        const char *data = buffer.data();
+        std::size_t left = buffer.size();
+        while (left > 0)
+        {
+            ssize_t written = ::write(fd, data, left);
+            if (written < 0)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                throw std::runtime_error(write_error);
+            }
+            data += written;
+            left -= (std::size_t)written;
+        }
+    }
+
+    /**
+     * writeStream - writes a whole buffer to a stream.
+     * @param os - stream to write to.
+     * @param buffer - bytes to write.
+     * @return (void)
+     * @possible_Exceptions - std::runtime_error - if the stream fails.
+     */
+    static void writeStream(std::ostream &os, const string &buffer)
+    {
+        if (!os.write(buffer.data(), (std::streamsize)buffer.size()))
+        {
+            throw std::runtime_error(write_error);
+        }
+    }
+
+    /**
+     * formatCalendar - formats the exams of a calendar into a buffer and hands the buffer to flush every time it
+     * holds at least buffer_size bytes, and once more at the end.
+     * @param calendar - calendar to format.
+     * @param buffer_size - number of bytes collected before flush is called.
+     * @param flush - called with the buffer to write it out.
+     * @return (void)
+     */
+    template <class Flush>
+    static void formatCalendar(const SortedList<ExamDetails> &calendar, const std::size_t buffer_size, Flush flush)
+    {
+        string buffer;
+        buffer.reserve(buffer_size + buffer_size / 4);
+        for (SortedList<ExamDetails>::const_iterator it = calendar.begin(); !(it == calendar.end()); ++it)
+        {
+            formatTo(buffer, *it);
+            if (buffer.size() >= buffer_size)
+            {
+                flush(buffer);
+                buffer.clear();
+            }
+        }
+        if (!buffer.empty())
+        {
+            flush(buffer);
+        }
+    }
+
+    void ExamWriter::write(const SortedList<ExamDetails> &calendar, const int fd, const std::size_t buffer_size)
+    {
+        formatCalendar(calendar, buffer_size, [fd](const string &buffer) { writeAll(fd, buffer); });
+    }
+
+    void ExamWriter::write(const SortedList<ExamDetails> &calendar, std::ostream &os, const std::size_t buffer_size)
+    {
+        formatCalendar(calendar, buffer_size, [&os](const string &buffer) { writeStream(os, buffer); });
+        if (!os.flush())
+        {
+            throw std::runtime_error(write_error);
+        }
+    }
+}
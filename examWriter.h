@@ -0,0 +1,46 @@
+#ifndef EXAM_WRITER_H
+#define EXAM_WRITER_H
+
+#include <cstddef>
+#include <iostream>
+#include <string>
+
+#include "examDetails.h"
+#include "sortedList.h"
+
+namespace mtm
+{
+    static const std::size_t default_write_buffer_size = 1 << 16;
+
+    /*
+     * ExamWriter prints exam calendars in the format of ExamDetails' operator<<, byte for byte. The exams are
+     * formatted with formatTo into one reusable buffer that is written out whenever it fills up, so a calendar
+     * costs one write per buffer instead of four stream flushes per exam.
+     */
+    class ExamWriter
+    {
+    public:
+        /**
+         * @brief Prints all the exams of a calendar, in order, to a file descriptor.
+         * @param calendar - calendar to print.
+         * @param fd - open file descriptor to write to.
+         * @param buffer_size - number of bytes collected before they are written.
+         * @return (void)
+         * @possible_Exceptions - std::runtime_error - if writing to fd fails.
+         */
+        static void write(const SortedList<ExamDetails> &calendar, const int fd,
+                          const std::size_t buffer_size = default_write_buffer_size);
+
+        /**
+         * @brief Prints all the exams of a calendar, in order, to a stream, flushing it once at the end.
+         * @param calendar - calendar to print.
+         * @param os - stream to write to.
+         * @param buffer_size - number of bytes collected before they are written.
+         * @return (void)
+         * @possible_Exceptions - std::runtime_error - if the stream fails.
+         */
+        static void write(const SortedList<ExamDetails> &calendar, std::ostream &os,
+                          const std::size_t buffer_size = default_write_buffer_size);
+    };
+}
+#endif
@@ -0,0 +1,139 @@
+#include "listStats.h"
+
+namespace mtm
+{
+    /**
+     * bucketOf - finds the histogram bucket of a value.
+     * @param value - recorded value.
+     * @return index of the bucket - the number of bits needed for value, capped at the last bucket.
+     */
+    static int bucketOf(std::uint64_t value)
+    {
+        int bucket = 0;
+        while (value != 0 && bucket < stats_histogram_buckets - 1)
+        {
+            value >>= 1;
+            bucket++;
+        }
+        return bucket;
+    }
+
+    /**
+     * writeCounter - writes one counter as a JSON member.
+     * @param os - stream to write to.
+     * @param name - name of the counter.
+     * @param counter - counter to write.
+     * @return (void)
+     */
+    static void writeCounter(std::ostream &os, const char *name, const std::atomic<std::uint64_t> &counter)
+    {
+        os << "\"" << name << "\": " << counter.load(std::memory_order_relaxed) << ", ";
+    }
+
+    StatsHistogram::StatsHistogram()
+    {
+        reset();
+    }
+
+    void StatsHistogram::record(const std::uint64_t value)
+    {
+        this->buckets[bucketOf(value)].fetch_add(1, std::memory_order_relaxed);
+        this->count.fetch_add(1, std::memory_order_relaxed);
+        this->sum.fetch_add(value, std::memory_order_relaxed);
+        std::uint64_t current_max = this->max.load(std::memory_order_relaxed);
+        while (value > current_max && !this->max.compare_exchange_weak(current_max, value, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    void StatsHistogram::reset()
+    {
+        for (int bucket = 0; bucket < stats_histogram_buckets; bucket++)
+        {
+            this->buckets[bucket].store(0, std::memory_order_relaxed);
+        }
+        this->count.store(0, std::memory_order_relaxed);
+        this->sum.store(0, std::memory_order_relaxed);
+        this->max.store(0, std::memory_order_relaxed);
+    }
+
+    std::uint64_t StatsHistogram::getCount() const
+    {
+        return this->count.load(std::memory_order_relaxed);
+    }
+
+    std::uint64_t StatsHistogram::getSum() const
+    {
+        return this->sum.load(std::memory_order_relaxed);
+    }
+
+    std::uint64_t StatsHistogram::getMax() const
+    {
+        return this->max.load(std::memory_order_relaxed);
+    }
+
+    void StatsHistogram::writeJson(std::ostream &os) const
+    {
+        os << "{\"count\": " << getCount() << ", \"sum\": " << getSum() << ", \"max\": " << getMax()
+           << ", \"buckets\": [";
+        bool first = true;
+        for (int bucket = 0; bucket < stats_histogram_buckets; bucket++)
+        {
+            std::uint64_t bucket_count = this->buckets[bucket].load(std::memory_order_relaxed);
+            if (bucket_count == 0)
+            {
+                continue;
+            }
+            os << (first ? "" : ", ") << "{\"below\": " << ((std::uint64_t)1 << bucket) << ", \"count\": "
+               << bucket_count << "}";
+            first = false;
+        }
+        os << "]}";
+    }
+
+    ListStats::ListStats()
+    {
+        reset();
+    }
+
+    void ListStats::reset()
+    {
+        std::atomic<std::uint64_t> *counters[] = {
+            &this->inserts,         &this->bulk_inserts,   &this->bulk_elements, &this->removes,
+            &this->lookups,         &this->comparisons,    &this->nodes_traversed, &this->finger_hits,
+            &this->iterator_steps,  &this->allocations,    &this->deallocations};
+        for (std::size_t i = 0; i < sizeof(counters) / sizeof(counters[0]); i++)
+        {
+            counters[i]->store(0, std::memory_order_relaxed);
+        }
+        this->search_length.reset();
+        this->insert_latency.reset();
+        this->remove_latency.reset();
+        this->lookup_latency.reset();
+    }
+
+    void ListStats::writeJson(std::ostream &os) const
+    {
+        os << "{";
+        writeCounter(os, "inserts", this->inserts);
+        writeCounter(os, "bulk_inserts", this->bulk_inserts);
+        writeCounter(os, "bulk_elements", this->bulk_elements);
+        writeCounter(os, "removes", this->removes);
+        writeCounter(os, "lookups", this->lookups);
+        writeCounter(os, "comparisons", this->comparisons);
+        writeCounter(os, "nodes_traversed", this->nodes_traversed);
+        writeCounter(os, "finger_hits", this->finger_hits);
+        writeCounter(os, "iterator_steps", this->iterator_steps);
+        writeCounter(os, "allocations", this->allocations);
+        writeCounter(os, "deallocations", this->deallocations);
+        os << "\"search_length\": ";
+        this->search_length.writeJson(os);
+        os << ", \"insert_latency_ns\": ";
+        this->insert_latency.writeJson(os);
+        os << ", \"remove_latency_ns\": ";
+        this->remove_latency.writeJson(os);
+        os << ", \"lookup_latency_ns\": ";
+        this->lookup_latency.writeJson(os);
+        os << "}";
+    }
+}
@@ -0,0 +1,136 @@
+#ifndef LIST_STATS_H
+#define LIST_STATS_H
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+
+namespace mtm
+{
+    static const int stats_histogram_buckets = 48;
+
+    /*
+     * StatsHistogram counts recorded values in power of two buckets: bucket 0 holds 0 and bucket i holds the values
+     * in [2^(i-1), 2^i). It may be recorded to from several threads at once.
+     */
+    class StatsHistogram
+    {
+        std::atomic<std::uint64_t> buckets[stats_histogram_buckets];
+        std::atomic<std::uint64_t> count;
+        std::atomic<std::uint64_t> sum;
+        std::atomic<std::uint64_t> max;
+
+    public:
+        StatsHistogram();
+        StatsHistogram(const StatsHistogram &histogram) = delete;
+        StatsHistogram &operator=(const StatsHistogram &histogram) = delete;
+
+        /**
+         * @brief Adds a value to the histogram.
+         * @param value - value to add.
+         * @return (void)
+         */
+        void record(const std::uint64_t value);
+
+        /**
+         * @brief Empties the histogram.
+         * @return (void)
+         */
+        void reset();
+
+        std::uint64_t getCount() const;
+        std::uint64_t getSum() const;
+        std::uint64_t getMax() const;
+
+        /**
+         * @brief Writes the histogram as a JSON object: count, sum, max and the non empty buckets, each with the
+         * exclusive upper bound of its values ("below") and its count.
+         * @param os - stream to write to.
+         * @return (void)
+         */
+        void writeJson(std::ostream &os) const;
+    };
+
+    /*
+     * Statistics of one SortedList, collected only when the program is built with MTM_SORTED_LIST_STATS defined
+     * (the same way in every translation unit). Without it SortedList holds no statistics and does no extra work.
+     * Counters are updated with relaxed atomics, so concurrent const operations on a list stay safe.
+     */
+    class ListStats
+    {
+    public:
+        std::atomic<std::uint64_t> inserts;
+        std::atomic<std::uint64_t> bulk_inserts;
+        std::atomic<std::uint64_t> bulk_elements;
+        std::atomic<std::uint64_t> removes;
+        std::atomic<std::uint64_t> lookups;
+        std::atomic<std::uint64_t> comparisons;
+        std::atomic<std::uint64_t> nodes_traversed;
+        // inserts placed next to the hint or the last insertion point, without searching from the top.
+        std::atomic<std::uint64_t> finger_hits;
+        std::atomic<std::uint64_t> iterator_steps;
+        std::atomic<std::uint64_t> allocations;
+        std::atomic<std::uint64_t> deallocations;
+        // nodes walked by every search of the list (insert, lookup, bound), from the top or from a finger.
+        StatsHistogram search_length;
+        // nanoseconds taken by every operation.
+        StatsHistogram insert_latency;
+        StatsHistogram remove_latency;
+        StatsHistogram lookup_latency;
+
+        ListStats();
+        ListStats(const ListStats &stats) = delete;
+        ListStats &operator=(const ListStats &stats) = delete;
+
+        /**
+         * @brief Sets all the counters and histograms back to zero.
+         * @return (void)
+         */
+        void reset();
+
+        /**
+         * @brief Writes all the counters and histograms as one JSON object.
+         * @param os - stream to write to.
+         * @return (void)
+         */
+        void writeJson(std::ostream &os) const;
+    };
+
+    /*
+     * Records the time from its construction to its destruction, in nanoseconds, into a histogram.
+     */
+    class StatsTimer
+    {
+        StatsHistogram &histogram;
+        std::chrono::steady_clock::time_point started;
+
+    public:
+        explicit StatsTimer(StatsHistogram &histogram)
+            : histogram(histogram), started(std::chrono::steady_clock::now())
+        {
+        }
+        StatsTimer(const StatsTimer &timer) = delete;
+        StatsTimer &operator=(const StatsTimer &timer) = delete;
+
+        ~StatsTimer()
+        {
+            this->histogram.record((std::uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                       std::chrono::steady_clock::now() - this->started)
+                                       .count());
+        }
+    };
+
+    /**
+     * @brief Adds to a statistics counter.
+     * @param counter - counter to add to.
+     * @param amount - amount to add.
+     * @return (void)
+     */
+    inline void countStat(std::atomic<std::uint64_t> &counter, const std::uint64_t amount = 1)
+    {
+        counter.fetch_add(amount, std::memory_order_relaxed);
+    }
+}
+#endif
@@ -0,0 +1,152 @@
+#include "nodePool.h"
+
+namespace mtm
+{
+    static const std::size_t chunk_header_size = pool_block_alignment;
+    static const std::size_t big_block_header_size = pool_block_alignment;
+
+    /**
+     * roundedBlockSize - rounds a block size up to a multiple of the pool alignment.
+     * @param bytes - requested size.
+     * @return the size of the block the pool hands out for the request.
+     */
+    static std::size_t roundedBlockSize(const std::size_t bytes)
+    {
+        if (bytes == 0)
+        {
+            return pool_block_alignment;
+        }
+        return (bytes + pool_block_alignment - 1) / pool_block_alignment * pool_block_alignment;
+    }
+
+    /**
+     * sizeClass - finds the free list a block size belongs to.
+     * @param block_size - rounded size of the block.
+     * @return index of the free list, pool_size_classes if the block is too big to be pooled.
+     */
+    static std::size_t sizeClass(const std::size_t block_size)
+    {
+        std::size_t size_class = block_size / pool_block_alignment - 1;
+        if (size_class >= pool_size_classes)
+        {
+            return pool_size_classes;
+        }
+        return size_class;
+    }
+
+    NodePool::NodePool(const std::size_t chunk_size) : chunks(nullptr), big_blocks(nullptr), current(nullptr),
+                                                       remaining(0), chunk_size(chunk_size)
+    {
+        static_assert(sizeof(BigBlock) <= big_block_header_size, "big block header doesn't fit its room");
+        if (this->chunk_size < chunk_header_size + pool_size_classes * pool_block_alignment)
+        {
+            this->chunk_size = chunk_header_size + pool_size_classes * pool_block_alignment;
+        }
+        for (std::size_t i = 0; i < pool_size_classes; i++)
+        {
+            this->free_lists[i] = nullptr;
+        }
+    }
+
+    NodePool::~NodePool()
+    {
+        release();
+    }
+
+    void NodePool::addChunk()
+    {
+        Chunk *chunk = static_cast<Chunk *>(::operator new(this->chunk_size));
+        chunk->next = this->chunks;
+        this->chunks = chunk;
+        this->current = reinterpret_cast<char *>(chunk) + chunk_header_size;
+        this->remaining = this->chunk_size - chunk_header_size;
+    }
+
+    void *NodePool::allocate(const std::size_t bytes)
+    {
+        std::size_t block_size = roundedBlockSize(bytes);
+        std::size_t size_class = sizeClass(block_size);
+        if (size_class == pool_size_classes)
+        {
+            BigBlock *big_block = static_cast<BigBlock *>(::operator new(big_block_header_size + block_size));
+            big_block->prev = nullptr;
+            big_block->next = this->big_blocks;
+            if (this->big_blocks != nullptr)
+            {
+                this->big_blocks->prev = big_block;
+            }
+            this->big_blocks = big_block;
+            return reinterpret_cast<char *>(big_block) + big_block_header_size;
+        }
+
+        FreeBlock *block = this->free_lists[size_class];
+        if (block != nullptr)
+        {
+            this->free_lists[size_class] = block->next;
+            return block;
+        }
+
+        if (this->remaining < block_size)
+        {
+            addChunk();
+        }
+        void *result = this->current;
+        this->current += block_size;
+        this->remaining -= block_size;
+        return result;
+    }
+
+    void NodePool::deallocate(void *block, const std::size_t bytes)
+    {
+        if (block == nullptr)
+        {
+            return;
+        }
+
+        std::size_t size_class = sizeClass(roundedBlockSize(bytes));
+        if (size_class == pool_size_classes)
+        {
+            BigBlock *big_block = reinterpret_cast<BigBlock *>(static_cast<char *>(block) - big_block_header_size);
+            if (big_block->prev != nullptr)
+            {
+                big_block->prev->next = big_block->next;
+            }
+            else
+            {
+                this->big_blocks = big_block->next;
+            }
+            if (big_block->next != nullptr)
+            {
+                big_block->next->prev = big_block->prev;
+            }
+            ::operator delete(big_block);
+            return;
+        }
+
+        FreeBlock *free_block = static_cast<FreeBlock *>(block);
+        free_block->next = this->free_lists[size_class];
+        this->free_lists[size_class] = free_block;
+    }
+
+    void NodePool::release()
+    {
+        while (this->chunks != nullptr)
+        {
+            Chunk *to_delete = this->chunks;
+            this->chunks = this->chunks->next;
+            ::operator delete(to_delete);
+        }
+        while (this->big_blocks != nullptr)
+        {
+            BigBlock *to_delete = this->big_blocks;
+            this->big_blocks = this->big_blocks->next;
+            ::operator delete(to_delete);
+        }
+        this->current = nullptr;
+        this->remaining = 0;
+        for (std::size_t i = 0; i < pool_size_classes; i++)
+        {
+            this->free_lists[i] = nullptr;
+        }
+    }
+}
@@ -0,0 +1,149 @@
+#ifndef NODE_POOL_H
+#define NODE_POOL_H
+
+#include <cstddef>
+#include <new>
+
+namespace mtm
+{
+    static const std::size_t pool_block_alignment = 16;
+    static const std::size_t pool_size_classes = 32;
+    static const std::size_t default_pool_chunk_size = 64 * 1024;
+
+    /*
+     * NodePool hands out small blocks (list nodes and their link towers) from big contiguous chunks.
+     * Freed blocks are kept in a free list of their size and reused by the next allocation of that size, and all
+     * the chunks are returned to the system at once when the pool is released or destroyed. Blocks too big for a
+     * size class are allocated on their own, but the pool keeps them in a list of its own and frees them with
+     * the chunks.
+     * A pool is not thread safe - every thread (or every group of lists used by one thread) needs its own pool.
+     */
+    class NodePool
+    {
+        struct Chunk
+        {
+            Chunk *next;
+        };
+
+        struct FreeBlock
+        {
+            FreeBlock *next;
+        };
+
+        struct BigBlock
+        {
+            BigBlock *prev;
+            BigBlock *next;
+        };
+
+        Chunk *chunks;
+        BigBlock *big_blocks;
+        char *current;
+        std::size_t remaining;
+        std::size_t chunk_size;
+        FreeBlock *free_lists[pool_size_classes];
+
+        /**
+         * @brief Allocates a new chunk for the pool and makes it the current one.
+         * @return (void)
+         */
+        void addChunk();
+
+    public:
+        /**
+         * @brief Constructs a new empty pool.
+         * @param chunk_size - size in bytes of every chunk the pool allocates from the system.
+         */
+        explicit NodePool(const std::size_t chunk_size = default_pool_chunk_size);
+
+        NodePool(const NodePool &pool) = delete;
+        NodePool &operator=(const NodePool &pool) = delete;
+
+        /**
+         * @brief Returns all the chunks of the pool to the system.
+         */
+        ~NodePool();
+
+        /**
+         * @brief Allocates a block of memory aligned to pool_block_alignment.
+         * @param bytes - size of the block.
+         * @return pointer to the new block.
+         * @possible_Exceptions - std::bad_alloc - if the system is out of memory.
+         */
+        void *allocate(const std::size_t bytes);
+
+        /**
+         * @brief Returns a block to the pool so the next allocation of the same size can reuse it.
+         * @param block - block that was allocated from this pool.
+         * @param bytes - size the block was allocated with.
+         * @return (void)
+         */
+        void deallocate(void *block, const std::size_t bytes);
+
+        /**
+         * @brief Frees every block of the pool in one operation, the big blocks too. A list destroys and
+         * deallocates its nodes one by one when it is destroyed, so every list that allocated from the pool must be
+         * destroyed or emptied first - SortedList::dropNodes empties a list in O(1) without touching its nodes,
+         * which makes list.dropNodes() followed by release() free a whole list at once.
+         * @return (void)
+         */
+        void release();
+    };
+
+    /*
+     * std::allocator compatible allocator which takes its memory from a NodePool.
+     * All the copies (and rebinds) of an allocator share the same pool.
+     */
+    template <class T>
+    class PoolAllocator
+    {
+        NodePool *pool;
+        template <class U>
+        friend class PoolAllocator;
+
+    public:
+        typedef T value_type;
+
+        PoolAllocator() = delete;
+        /**
+         * @brief Constructs an allocator that allocates from pool.
+         * @param pool - pool to take the memory from, must outlive the allocator and everything it allocated.
+         */
+        explicit PoolAllocator(NodePool &pool) : pool(&pool) {}
+
+        /**
+         * @brief Constructs an allocator of T which shares the pool of another allocator.
+         * @param allocator - allocator of another type.
+         */
+        template <class U>
+        PoolAllocator(const PoolAllocator<U> &allocator) : pool(allocator.pool) {}
+
+        /**
+         * @brief Allocates room for n elements of T.
+         * @param n - number of elements.
+         * @return pointer to the new room.
+         */
+        T *allocate(const std::size_t n)
+        {
+            static_assert(alignof(T) <= pool_block_alignment, "type is over aligned for the pool");
+            return static_cast<T *>(this->pool->allocate(n * sizeof(T)));
+        }
+
+        /**
+         * @brief Returns room of n elements of T to the pool.
+         * @param elements - pointer returned by allocate.
+         * @param n - number of elements it was allocated with.
+         * @return (void)
+         */
+        void deallocate(T *elements, const std::size_t n)
+        {
+            this->pool->deallocate(elements, n * sizeof(T));
+        }
+
+        template <class U>
+        bool operator==(const PoolAllocator<U> &allocator) const { return this->pool == allocator.pool; }
+        template <class U>
+        bool operator!=(const PoolAllocator<U> &allocator) const { return this->pool != allocator.pool; }
+    };
+}
+#endif
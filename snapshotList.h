@@ -0,0 +1,308 @@
+#ifndef SNAPSHOT_LIST_H
+#define SNAPSHOT_LIST_H
+#include <atomic>
+#include <memory>
+#include <utility>
+
+#include "sortedList.h"
+
+namespace mtm
+{
+    /*
+     * SnapshotList is a copy on write SortedList. Copying it is O(1) - the copies share the same elements - and
+     * the elements are copied (in O(n)) only when a list that shares them is changed. A reader that keeps a copy
+     * holds a stable snapshot: the writer's next change detaches the writer, never the reader.
+     * Different SnapshotList objects may be used from different threads, but one object needs external
+     * synchronization like any other container. A snapshot may be released on any thread: use_count() is only a
+     * relaxed load, so after the writer sees it drop to 1 an acquire fence orders its changes after the reader's
+     * last access to the shared elements.
+     */
+    template <class T, class Compare = std::less<T>, class KeyOf = IdentityKey<T>, class Alloc = std::allocator<T>>
+    class SnapshotList
+    {
+        std::shared_ptr<SortedList<T, Compare, KeyOf, Alloc>> list;
+
+        /**
+         * @brief Makes sure no other SnapshotList shares the elements of this one, copying them if needed.
+         * @return the list this object may change.
+         */
+        SortedList<T, Compare, KeyOf, Alloc> &detach();
+
+    public:
+        typedef typename SortedList<T, Compare, KeyOf, Alloc>::const_iterator const_iterator;
+
+        /**
+         * @brief Constructs a new empty list.
+         * @param allocator - allocator the list allocates its nodes with.
+         */
+        explicit SnapshotList(const Alloc &allocator = Alloc());
+
+        /**
+         * @brief Constructs a new shared list that takes over the elements of a SortedList.
+         * @param sorted_list - list we take the elements from.
+         */
+        explicit SnapshotList(SortedList<T, Compare, KeyOf, Alloc> &&sorted_list);
+
+        /**
+         * @brief Constructs a list that shares the elements of another one, in O(1).
+         * @param snapshot_list - list we share the elements with.
+         */
+        SnapshotList(const SnapshotList &snapshot_list) = default;
+        ~SnapshotList() = default;
+        SnapshotList &operator=(const SnapshotList &snapshot_list) = default;
+
+        /**
+         * @brief snapshot
+         * @return A copy of the list that keeps the current elements no matter how this list changes later.
+         */
+        SnapshotList snapshot() const;
+
+        /**
+         * @brief inserts a new data to the list while keeping it sorted, copying the shared elements first.
+         * @param data - new data we want to insert into the list.
+         * @return A const iterator that points to the new element.
+         */
+        const_iterator insert(const T &data);
+
+        /**
+         * @brief inserts a new data to the list by moving it, copying the shared elements first.
+         * @param data - new data we want to move into the list.
+         * @return A const iterator that points to the new element.
+         */
+        const_iterator insert(T &&data);
+
+        /**
+         * @brief Constructs a new element and inserts it to the list, copying the shared elements first.
+         * @param args - arguments for the constructor of the new element.
+         * @return A const iterator that points to the new element.
+         */
+        template <class... Args>
+        const_iterator emplace(Args &&...args);
+
+        /**
+         * @brief inserts all the elements of a range to the list, copying the shared elements first.
+         * @param first - iterator to the first element of the range.
+         * @param last - iterator past the last element of the range.
+         * @return (void)
+         */
+        template <class InputIterator>
+        void insertRange(InputIterator first, InputIterator last);
+
+        /**
+         * @brief Removes the element which the iterator points to, copying the shared elements first.
+         * @param iterator - iterator of this list (taken before the call) which points to the element.
+         * @return (void)
+         * @possible_Exceptions - std::out_of_range - if the iterator is pointing outside of the list.
+         */
+        void remove(const const_iterator &iterator);
+
+        /**
+         * @brief Length
+         * @return Returns the number of elements in the list.
+         */
+        int length() const;
+
+        /**
+         * @brief getList
+         * @return The current elements of the list, valid until this list is changed.
+         */
+        const SortedList<T, Compare, KeyOf, Alloc> &getList() const;
+
+        const_iterator begin() const;
+        const_iterator end() const;
+        const_iterator find(const T &data) const;
+        bool contains(const T &data) const;
+        const_iterator lowerBound(const T &data) const;
+        const_iterator upperBound(const T &data) const;
+        std::pair<const_iterator, const_iterator> equalRange(const T &lo, const T &hi) const;
+
+        /**
+         * @brief Filters the list to a new SortedList, see SortedList::filter.
+         * @param c A boolian condition which filters only the elements that return true with it.
+         * @return A new result list after the filter was applied.
+         */
+        template <class Condition>
+        SortedList<T, Compare, KeyOf, Alloc> filter(Condition c) const;
+
+        /**
+         * @brief Applies an operation on the list elements into a new SortedList, see SortedList::apply.
+         * @param op - A function that we apply on each element in the list.
+         * @return - A new result list with the results of op.
+         */
+        template <class Operation>
+        SortedList<T, Compare, KeyOf, Alloc> apply(Operation op) const;
+    };
+
+    template <class T, class Compare, class KeyOf, class Alloc>
+    SnapshotList<T, Compare, KeyOf, Alloc>::SnapshotList(const Alloc &allocator)
+        : list(std::make_shared<SortedList<T, Compare, KeyOf, Alloc>>(allocator))
+    {
+    }
+
+    template <class T, class Compare, class KeyOf, class Alloc>
+    SnapshotList<T, Compare, KeyOf, Alloc>::SnapshotList(SortedList<T, Compare, KeyOf, Alloc> &&sorted_list)
+        : list(std::make_shared<SortedList<T, Compare, KeyOf, Alloc>>(std::move(sorted_list)))
+    {
+    }
+
+    template <class T, class Compare, class KeyOf, class Alloc>
+    SortedList<T, Compare, KeyOf, Alloc> &SnapshotList<T, Compare, KeyOf, Alloc>::detach()
+    {
+        if (this->list.use_count() > 1)
+        {
+            this->list = std::make_shared<SortedList<T, Compare, KeyOf, Alloc>>(*this->list);
+        }
+        else
+        {
+            // pairs with the release decrement of the last snapshot that let go of the elements.
+            std::atomic_thread_fence(std::memory_order_acquire);
+        }
+        return *this->list;
+    }
+
+    template <class T, class Compare, class KeyOf, class Alloc>
+    SnapshotList<T, Compare, KeyOf, Alloc> SnapshotList<T, Compare, KeyOf, Alloc>::snapshot() const
+    {
+        return *this;
+    }
+
+    template <class T, class Compare, class KeyOf, class Alloc>
+    typename SnapshotList<T, Compare, KeyOf, Alloc>::const_iterator
+    SnapshotList<T, Compare, KeyOf, Alloc>::insert(const T &data)
+    {
+        return detach().insert(data);
+    }
+
+    template <class T, class Compare, class KeyOf, class Alloc>
+    typename SnapshotList<T, Compare, KeyOf, Alloc>::const_iterator
+    SnapshotList<T, Compare, KeyOf, Alloc>::insert(T &&data)
+    {
+        return detach().insert(std::move(data));
+    }
+
+    template <class T, class Compare, class KeyOf, class Alloc>
+    template <class... Args>
+    typename SnapshotList<T, Compare, KeyOf, Alloc>::const_iterator
+    SnapshotList<T, Compare, KeyOf, Alloc>::emplace(Args &&...args)
+    {
+        return detach().emplace(std::forward<Args>(args)...);
+    }
+
+    template <class T, class Compare, class KeyOf, class Alloc>
+    template <class InputIterator>
+    void SnapshotList<T, Compare, KeyOf, Alloc>::insertRange(InputIterator first, InputIterator last)
+    {
+        detach().insertRange(first, last);
+    }
+
+    template <class T, class Compare, class KeyOf, class Alloc>
+    void SnapshotList<T, Compare, KeyOf, Alloc>::remove(const const_iterator &iterator)
+    {
+        if (iterator == end())
+        {
+            throw std::out_of_range(out_of_range_error);
+        }
+        if (this->list.use_count() == 1)
+        {
+            std::atomic_thread_fence(std::memory_order_acquire);
+            this->list->remove(iterator);
+            return;
+        }
+
+        // the iterator points into the shared elements, so it is moved to the same position in the copy.
+        int position = 0;
+        const_iterator it = begin();
+        while (!(it == end()) && !(it == iterator))
+        {
+            ++it;
+            position++;
+        }
+        if (it == end())
+        {
+            return;
+        }
+        SortedList<T, Compare, KeyOf, Alloc> &own_list = detach();
+        it = own_list.begin();
+        for (int i = 0; i < position; i++)
+        {
+            ++it;
+        }
+        own_list.remove(it);
+    }
+
+    template <class T, class Compare, class KeyOf, class Alloc>
+    int SnapshotList<T, Compare, KeyOf, Alloc>::length() const
+    {
+        return this->list->length();
+    }
+
+    template <class T, class Compare, class KeyOf, class Alloc>
+    const SortedList<T, Compare, KeyOf, Alloc> &SnapshotList<T, Compare, KeyOf, Alloc>::getList() const
+    {
+        return *this->list;
+    }
+
+    template <class T, class Compare, class KeyOf, class Alloc>
+    typename SnapshotList<T, Compare, KeyOf, Alloc>::const_iterator
+    SnapshotList<T, Compare, KeyOf, Alloc>::begin() const
+    {
+        return this->list->begin();
+    }
+
+    template <class T, class Compare, class KeyOf, class Alloc>
+    typename SnapshotList<T, Compare, KeyOf, Alloc>::const_iterator
+    SnapshotList<T, Compare, KeyOf, Alloc>::end() const
+    {
+        return this->list->end();
+    }
+
+    template <class T, class Compare, class KeyOf, class Alloc>
+    typename SnapshotList<T, Compare, KeyOf, Alloc>::const_iterator
+    SnapshotList<T, Compare, KeyOf, Alloc>::find(const T &data) const
+    {
+        return this->list->find(data);
+    }
+
+    template <class T, class Compare, class KeyOf, class Alloc>
+    bool SnapshotList<T, Compare, KeyOf, Alloc>::contains(const T &data) const
+    {
+        return this->list->contains(data);
+    }
+
+    template <class T, class Compare, class KeyOf, class Alloc>
+    typename SnapshotList<T, Compare, KeyOf, Alloc>::const_iterator
+    SnapshotList<T, Compare, KeyOf, Alloc>::lowerBound(const T &data) const
+    {
+        return this->list->lowerBound(data);
+    }
+
+    template <class T, class Compare, class KeyOf, class Alloc>
+    typename SnapshotList<T, Compare, KeyOf, Alloc>::const_iterator
+    SnapshotList<T, Compare, KeyOf, Alloc>::upperBound(const T &data) const
+    {
+        return this->list->upperBound(data);
+    }
+
+    template <class T, class Compare, class KeyOf, class Alloc>
+    std::pair<typename SnapshotList<T, Compare, KeyOf, Alloc>::const_iterator,
+              typename SnapshotList<T, Compare, KeyOf, Alloc>::const_iterator>
+    SnapshotList<T, Compare, KeyOf, Alloc>::equalRange(const T &lo, const T &hi) const
+    {
+        return this->list->equalRange(lo, hi);
+    }
+
+    template <class T, class Compare, class KeyOf, class Alloc>
+    template <class Condition>
+    SortedList<T, Compare, KeyOf, Alloc> SnapshotList<T, Compare, KeyOf, Alloc>::filter(Condition c) const
+    {
+        return this->list->filter(c);
+    }
+
+    template <class T, class Compare, class KeyOf, class Alloc>
+    template <class Operation>
+    SortedList<T, Compare, KeyOf, Alloc> SnapshotList<T, Compare, KeyOf, Alloc>::apply(Operation op) const
+    {
+        return this->list->apply(op);
+    }
+}
+#endif
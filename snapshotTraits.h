@@ -0,0 +1,19 @@
+#ifndef SNAPSHOT_TRAITS_H
+#define SNAPSHOT_TRAITS_H
+#include <type_traits>
+
+namespace mtm
+{
+    /*
+     * SnapshotTraits tells the storage functions of sortedListStorage.h whether the raw bytes of a type can be
+     * written to a file and mapped back by another process. That holds for trivially copyable types, unless they
+     * keep process local state (pointers, handles) - such a type specializes this with mappable = false.
+     */
+    template <class T>
+    class SnapshotTraits
+    {
+    public:
+        static const bool mappable = std::is_trivially_copyable<T>::value;
+    };
+}
+#endif
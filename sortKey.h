@@ -0,0 +1,18 @@
+#ifndef SORT_KEY_H
+#define SORT_KEY_H
+
+namespace mtm
+{
+    /*
+     * SortKeyTraits tells SortedList that the order of a type is the order of a small non negative integer key.
+     * A specialization sets has_key to true and provides key_limit (every key is smaller than it) and
+     * key(data), and then SortedList sorts bulk input of the type with a counting sort instead of comparisons.
+     */
+    template <class T>
+    class SortKeyTraits
+    {
+    public:
+        static const bool has_key = false;
+    };
+}
+#endif
@@ -1,29 +1,115 @@
 #ifndef SORTED_LIST_H
 #define SORTED_LIST_H
 #include <iostream>
+#include <algorithm>
+#include <exception>
+#include <functional>
+#include <memory>
 #include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
+#include "sortKey.h"
+
+/*
+ * Building with MTM_SORTED_LIST_STATS defined makes every SortedList collect statistics (see listStats.h) and
+ * adds getStats and resetStats. Without it the statistics code is compiled out completely.
+ */
+#ifdef MTM_SORTED_LIST_STATS
+#include "listStats.h"
+#define MTM_LIST_STATS(...) __VA_ARGS__
+#else
+#define MTM_LIST_STATS(...)
+#endif
 
 namespace mtm
 {
     static const std::string out_of_range_error = "out of range";
-    static const int empty_list = - 1;
+    static const int max_list_level = 16;
+    static const unsigned int level_seed = 2463534242u;
+    static const int bulk_insert_ratio = 16;
+    static const int counting_sort_ratio = 4;
+    // nodes an insert walks from its hint before it gives up and searches from the top of the list.
+    static const int finger_walk_limit = 8;
+
+    /*
+     * The default key of a SortedList element - the element itself.
+     */
     template <class T>
+    class IdentityKey
+    {
+    public:
+        const T &operator()(const T &data) const { return data; }
+    };
+
+    template <class T, class Compare = std::less<T>, class KeyOf = IdentityKey<T>, class Alloc = std::allocator<T>>
     class SortedList;
+    template <class Iterator, class Condition>
+    class FilterView;
+    template <class Iterator, class Operation>
+    class TransformView;
+
+    /*
+     * Execution policy for the parallel overloads of SortedList::filter and SortedList::apply.
+     * The condition or operation is called concurrently from several threads, so it must be safe to do so.
+     */
+    class ParallelPolicy
+    {
+        unsigned int threads;
+
+    public:
+        /**
+         * @brief Constructs a policy that runs on a given number of threads.
+         * @param threads - number of threads, 0 - as many as the hardware runs concurrently.
+         */
+        explicit ParallelPolicy(const unsigned int threads = 0) : threads(threads) {}
+
+        /**
+         * @brief threadCount
+         * @return The number of threads to run on, at least 1.
+         */
+        unsigned int threadCount() const
+        {
+            unsigned int count = this->threads == 0 ? std::thread::hardware_concurrency() : this->threads;
+            return count == 0 ? 1 : count;
+        }
+    };
 
     template <class T>
     class Node
     {
         T data;
         Node<T> *next;
+        Node<T> *prev;
+        int height;
+        Node<T> **tower;
+
+        /**
+         * @brief Gives access to the node's successor in one of the list levels.
+         * @param level - level of the list, 0 is the full list and every level above it skips over more nodes.
+         * @return reference to the pointer of the next node in the given level.
+         */
+        Node<T> *&forward(const int level) { return level == 0 ? this->next : this->tower[2 * level - 2]; }
+
+        /**
+         * @brief Gives access to the node's predecessor in one of the list levels.
+         * @param level - level of the list.
+         * @return reference to the pointer of the previous node in the given level, nullptr for the first one.
+         */
+        Node<T> *&backward(const int level) { return level == 0 ? this->prev : this->tower[2 * level - 1]; }
 
     public:
         Node() = delete;
         /**
-        * @brief Constructs new node wich holds type T data
-        * @param data - data from a generic type.
+        * @brief Constructs new node wich holds type T data, built in place from args.
+        * @param height - number of list levels the node takes part of.
+        * @param tower - array of 2 * (height - 1) next and previous pointers for the levels above the first one.
+        * @param args - arguments for the constructor of the data.
         */
-        Node(const T data);
+        template <class... Args>
+        Node(const int height, Node<T> **tower, Args &&...args);
         /**
         * Copy Constractor - default function.
         * @brief Constructs a copy of the node that given as parameter.
@@ -41,25 +127,276 @@ namespace mtm
         * @param node - The node to make copy of himself.
         */
         Node &operator=(const Node<T> &node) = default;
-        friend class SortedList<T>;
+        template <class U, class C, class K, class A>
+        friend class SortedList;
     };
 
     template <class T>
-    Node<T>::Node(const T data) : data(data), next(nullptr)
+    template <class... Args>
+    Node<T>::Node(const int height, Node<T> **tower, Args &&...args) : data(std::forward<Args>(args)...),
+                                                                        next(nullptr), prev(nullptr), height(height),
+                                                                        tower(tower)
     {
     }
 
-    template <class T>
+    /*
+     * SortedList keeps its elements ordered by Compare applied to the keys KeyOf takes from them - by default the
+     * elements themselves compared with operator<. Compare and KeyOf are stateless function objects, so the same
+     * element type can be kept in lists of different orders (by course, by duration...) without wrapping it.
+     */
+    template <class T, class Compare, class KeyOf, class Alloc>
     class SortedList
     {
-        Node<T> *head;
+        typedef typename std::allocator_traits<Alloc>::template rebind_alloc<Node<T>> NodeAllocator;
+        typedef typename std::allocator_traits<Alloc>::template rebind_alloc<Node<T> *> TowerAllocator;
+        typedef std::allocator_traits<NodeAllocator> NodeTraits;
+        typedef std::allocator_traits<TowerAllocator> TowerTraits;
+
+        /*
+         * The order of the list: a is before b when Compare(KeyOf(a), KeyOf(b)). Both are stateless and built on
+         * the spot, so a comparison compiles to the same code as writing it by hand.
+         */
+        class ElementCompare
+        {
+        public:
+            bool operator()(const T &first, const T &second) const
+            {
+                return Compare()(KeyOf()(first), KeyOf()(second));
+            }
+        };
+
+        /**
+         * @brief The one comparison of the list - every ordering decision goes through it.
+         * @param first - element to check.
+         * @param second - element to compare with.
+         * @return true - if first goes before second in the list, false - otherwise.
+         */
+        bool before(const T &first, const T &second) const
+        {
+            MTM_LIST_STATS(countStat(this->stats.comparisons);)
+            return ElementCompare()(first, second);
+        }
+
+        /*
+         * before() as a function object, for the standard algorithms that sort and check batches of elements.
+         * It holds the list only to count comparisons, so without statistics it stays an empty class the
+         * algorithms can inline like ElementCompare.
+         */
+        class BeforeCompare
+        {
+#ifdef MTM_SORTED_LIST_STATS
+            const SortedList *list;
+
+        public:
+            explicit BeforeCompare(const SortedList *list) : list(list) {}
+            bool operator()(const T &first, const T &second) const { return this->list->before(first, second); }
+#else
+        public:
+            explicit BeforeCompare(const SortedList *) {}
+            bool operator()(const T &first, const T &second) const { return ElementCompare()(first, second); }
+#endif
+        };
+
+        // batches are sorted by SortKeyTraits<T> only when the list keeps the natural order of T.
+        typedef std::integral_constant<bool, SortKeyTraits<T>::has_key && std::is_same<Compare, std::less<T>>::value &&
+                                                 std::is_same<KeyOf, IdentityKey<T>>::value>
+            UsesSortKey;
+
+        /*
+         * The list is kept as a doubly linked skip list: heads[0] is the full sorted chain of nodes and every level
+         * above it links only the nodes that are at least that tall, so searches skip over most of the list and a
+         * node can be unlinked from all of its levels without searching for its predecessors.
+         */
+        Node<T> *heads[max_list_level];
+        int levels;
         int size;
+        unsigned int seed;
+        // the last node linked to the list, where the next insert looks first - nullptr when there is none.
+        Node<T> *finger;
+        NodeAllocator node_allocator;
+        TowerAllocator tower_allocator;
+#ifdef MTM_SORTED_LIST_STATS
+        mutable ListStats stats;
+#endif
         /**
          * @brief destroys all list elements without destroying the list itself.
          * @return (void)
          */
         void DestroyList();
 
+        /**
+         * @brief Resets the list levels to an empty list without deallocating any node.
+         * @return (void)
+         */
+        void resetLevels();
+
+        /**
+         * @brief Draws a height for a new node, every level is reached with probability of 1/4.
+         * @return the number of levels the new node takes part of.
+         */
+        int randomHeight();
+
+        /**
+         * @brief Allocates a new node (and its tower of upper level links) and builds its data in place.
+         * @param height - number of levels the new node takes part of.
+         * @param args - arguments for the constructor of the data.
+         * @return the new node, not linked to any other node.
+         */
+        template <class... Args>
+        Node<T> *createNode(const int height, Args &&...args);
+
+        /**
+         * @brief Finds the predecessors of a new node by walking from a node close to its place, instead of
+         * searching from the top of the list. The walk takes O(1) expected time when the node belongs within
+         * finger_walk_limit nodes of near.
+         * @param data - data of the new node.
+         * @param height - height of the new node, the levels to find predecessors in.
+         * @param near - node of the list to start from, nullptr for none.
+         * @param update - filled with the last node in each level the new node goes after (nullptr - the head).
+         * @return true - if the predecessors were found, false - if the node belongs too far from near.
+         */
+        bool findNearPredecessors(const T &data, const int height, Node<T> *near, Node<T> **update) const;
+
+        /**
+         * @brief Links a new node to the list after all the elements that are not bigger than it, and makes it
+         * the finger of the list.
+         * @param new_node - node to link.
+         * @param near - node of the list the new node probably belongs next to, nullptr for none.
+         * @return (void)
+         */
+        void linkNode(Node<T> *new_node, Node<T> *near);
+
+        /**
+         * @brief Takes a node out of every level of the list without deallocating it.
+         * @param node - node to unlink.
+         * @return (void)
+         */
+        void unlinkNode(Node<T> *node);
+
+        /**
+         * @brief Drops the empty levels at the top of the list after nodes were unlinked.
+         * @return (void)
+         */
+        void trimLevels();
+
+        /**
+         * @brief Moves a node whose data was changed to the place its data belongs to, if it isn't there already.
+         * @param node - node of this list.
+         * @return (void)
+         */
+        void relinkNode(Node<T> *node);
+
+        /**
+         * @brief Deallocates a node and its tower of upper level links.
+         * @param node - node to deallocate.
+         * @return (void)
+         */
+        void destroyNode(Node<T> *node);
+
+        /**
+         * @brief Gives access to the link that follows pred in a specific level.
+         * @param pred - node to take the link from, nullptr stands for the head of the level.
+         * @param level - level of the link.
+         * @return reference to the pointer of the node which follows pred in the level.
+         */
+        Node<T> *&link(Node<T> *pred, const int level);
+
+        /**
+         * @brief Finds in every level the last node that comes before data.
+         * @param data - data to search for.
+         * @param update - array of max_list_level nodes which is filled with the predecessor in every level
+         * (nullptr if data belongs at the head of the level).
+         * @param include_equal - true - nodes equal to data count as predecessors, false - only smaller ones.
+         * @return (void)
+         */
+        void findPredecessors(const T &data, Node<T> **update, const bool include_equal) const;
+
+        /**
+         * @brief Finds the first node that comes after data, in O(log n) expected time.
+         * @param data - data to search for.
+         * @param include_equal - true - skips the nodes equal to data, false - stops at the first of them.
+         * @return the first node not smaller than data (or bigger than data if include_equal), nullptr if there
+         * is none.
+         */
+        Node<T> *findSuccessor(const T &data, const bool include_equal) const;
+
+        /**
+         * @brief Finds the last node of every level.
+         * @param tails - array of max_list_level nodes which is filled with the last node in every level
+         * (nullptr for an empty level).
+         * @return (void)
+         */
+        void findTails(Node<T> **tails) const;
+
+        /**
+         * @brief Links a node after the last node of every level it takes part of, without any comparison.
+         * The caller keeps the list sorted and updates its size.
+         * @param node - node to link.
+         * @param tails - last node of every level, updated to node on the levels it was linked to.
+         * @return (void)
+         */
+        void appendNode(Node<T> *node, Node<T> **tails);
+
+        /**
+         * @brief Creates a node for data and links it after the current elements of the list.
+         * @param data - data of the new element, must not be smaller than the last element of the list.
+         * @param tails - last node of every level, updated to the new node on the levels it was linked to.
+         * @return (void)
+         */
+        template <class Data>
+        void appendElement(Data &&data, Node<T> **tails);
+
+        /**
+         * @brief Appends copies of a sorted range after the current elements of the list in O(n).
+         * @param first - iterator to the first element of the range.
+         * @param last - iterator past the last element of the range.
+         * @return (void)
+         */
+        template <class Iterator>
+        void appendSorted(Iterator first, Iterator last);
+
+        /**
+         * @brief Copies a range and sorts it, unless it is already sorted.
+         * @param first - iterator to the first element of the range.
+         * @param last - iterator past the last element of the range.
+         * @return the range elements, sorted and with equal elements in their original order.
+         */
+        template <class InputIterator>
+        std::vector<T> sortedBatch(InputIterator first, InputIterator last) const;
+
+        /**
+         * @brief Sorts a batch by comparing its elements. Equal elements keep their order.
+         * @param batch - elements to sort.
+         * @return (void)
+         */
+        void sortBatch(std::vector<T> &batch, std::false_type) const;
+
+        /**
+         * @brief Sorts a batch by the integer keys of SortKeyTraits<T> with a counting sort, in O(n + key_limit).
+         * Equal elements keep their order. Small batches are sorted by comparing.
+         * @param batch - elements to sort.
+         * @return (void)
+         */
+        void sortBatch(std::vector<T> &batch, std::true_type) const;
+
+        /**
+         * @brief Swaps the elements (and allocators) of two lists.
+         * @param other_list - list to swap with.
+         * @return (void)
+         */
+        void swapContents(SortedList &other_list);
+
+        /**
+         * @brief Splits the list into consecutive chunks, one per thread of the policy, and runs a task on every
+         * chunk concurrently. The first exception thrown by a task is rethrown after all the threads are done.
+         * @param policy - policy which sets the number of threads.
+         * @param task - called as task(chunk, first_node, count, offset) for every chunk, where offset is the
+         * position of first_node in the list.
+         * @return the number of chunks the list was split into.
+         */
+        template <class Task>
+        int forEachChunk(const ParallelPolicy &policy, Task task) const;
+
     public:
         class const_iterator;
         /**
@@ -67,12 +404,34 @@ namespace mtm
          */
         SortedList();
 
+        /**
+         * @brief Constructs a new empty list which allocates its nodes through allocator.
+         * @param allocator - std::allocator compatible allocator, e.g. a PoolAllocator of a NodePool.
+         */
+        explicit SortedList(const Alloc &allocator);
+
         /**
          * @brief Constructs a new list using another sorted_list elements.
          * @param sorted_list - list we want to copy.
          */
         SortedList(const SortedList &sorted_list);
 
+        /**
+         * @brief Constructs a new list that takes over the elements of another list, leaving it empty.
+         * @param sorted_list - list we take the elements from.
+         */
+        SortedList(SortedList &&sorted_list) noexcept;
+
+        /**
+         * @brief Constructs a new list from the elements of a range, sorting them once. An already sorted range is
+         * linked in O(n), otherwise building takes O(n log n).
+         * @param first - iterator to the first element of the range.
+         * @param last - iterator past the last element of the range.
+         * @param allocator - allocator the list allocates its nodes with.
+         */
+        template <class InputIterator>
+        SortedList(InputIterator first, InputIterator last, const Alloc &allocator = Alloc());
+
         /**
          * @brief Dealocates a list and all it's elements.
          */
@@ -84,22 +443,191 @@ namespace mtm
          * @return this after it has changed.
          */
         SortedList &operator=(const SortedList &other_list);
+
+        /**
+         * @brief Deallocates the list elements and takes over the elements of another list, leaving it empty.
+         * @param other_list - list we take the elements from.
+         * @return this after it has changed.
+         */
+        SortedList &operator=(SortedList &&other_list) noexcept;
+
+        /**
+         * @brief getAllocator
+         * @return A copy of the allocator the list allocates its nodes with.
+         */
+        Alloc getAllocator() const;
+
+        /**
+         * @brief Empties the list in O(1) without destroying or deallocating its nodes, for lists whose memory is
+         * taken back all at once - e.g. by NodePool::release, which frees a whole list in one operation when it
+         * follows dropNodes:
+         *     list.dropNodes();
+         *     pool.release();
+         * With an allocator that doesn't take the memory back, the nodes are leaked.
+         * @return (void)
+         */
+        void dropNodes();
+
+#ifdef MTM_SORTED_LIST_STATS
+        /**
+         * @brief getStats - only built with MTM_SORTED_LIST_STATS.
+         * @return The statistics of the list since it was constructed or since resetStats was called. Copies and
+         * moved lists start with their own empty statistics.
+         */
+        const ListStats &getStats() const;
+
+        /**
+         * @brief Sets the statistics of the list back to zero - only built with MTM_SORTED_LIST_STATS.
+         * @return (void)
+         */
+        void resetStats() const;
+#endif
         
         /**
-         * @brief inserts a new data to the list while keeping it sorted.
+         * @brief inserts a new data to the list while keeping it sorted, in O(log n) expected time.
+         * Equal elements keep their insertion order.
          * @param data - new data we want to insert into the list.
+         * @return A const iterator that points to the new element.
+         */
+        const_iterator insert(const T &data);
+
+        /**
+         * @brief inserts a new data to the list by moving it into the list node.
+         * @param data - new data we want to move into the list.
+         * @return A const iterator that points to the new element.
+         */
+        const_iterator insert(T &&data);
+
+        /**
+         * @brief Constructs a new element directly inside its list node and inserts it while keeping the list
+         * sorted, no copy of the element is made.
+         * @param args - arguments for the constructor of the new element.
+         * @return A const iterator that points to the new element.
+         */
+        template <class... Args>
+        const_iterator emplace(Args &&...args);
+
+        /**
+         * @brief Inserts a new element next to a hint of where it belongs. When the element goes right before the
+         * hint, or within a few nodes of it, the insert takes O(1) expected time instead of O(log n); otherwise
+         * it is placed like insert(data). The element is placed after the elements equal to it either way.
+         * Inserts without a hint start from the last insertion point the same way, so a stream that is sorted or
+         * almost sorted (in either direction) is inserted in amortized O(1) per element.
+         * @param hint - iterator to the element the new one probably goes before. end() stands for the last
+         * insertion point. An iterator of another list is ignored.
+         * @param data - data to insert.
+         * @return iterator to the new element.
+         */
+        const_iterator insert(const const_iterator &hint, const T &data);
+        const_iterator insert(const const_iterator &hint, T &&data);
+
+        /**
+         * @brief Builds a new element in place from args next to a hint of where it belongs, see
+         * insert(hint, data).
+         * @param hint - iterator to the element the new one probably goes before.
+         * @param args - arguments for the constructor of the element.
+         * @return iterator to the new element.
+         */
+        template <class... Args>
+        const_iterator emplaceHint(const const_iterator &hint, Args &&...args);
+
+        /**
+         * @brief Replaces the list elements with the elements of a range, sorting them once.
+         * @param first - iterator to the first element of the range.
+         * @param last - iterator past the last element of the range.
+         * @return (void)
+         */
+        template <class InputIterator>
+        void assign(InputIterator first, InputIterator last);
+
+        /**
+         * @brief inserts all the elements of a range to the list while keeping it sorted. The range is sorted once
+         * and merged with the list in a single pass, small ranges are inserted one by one.
+         * @param first - iterator to the first element of the range.
+         * @param last - iterator past the last element of the range.
+         * @return (void)
+         */
+        template <class InputIterator>
+        void insertRange(InputIterator first, InputIterator last);
+
+        /**
+         * @brief Moves all the elements of another sorted list into this list in a single O(n + m) pass, by
+         * relinking the nodes of both lists. Nothing is allocated when both lists use equal allocators.
+         * Equal elements of this list come before the ones of other_list.
+         * @param other_list - list we take the elements from, empty after the merge.
          * @return (void)
          */
-        void insert(const T &data);
+        void merge(SortedList &&other_list);
+
+        /**
+         * @brief Creates the union of two sorted lists in a single pass. An element which appears several times
+         * appears in the result as many times as it appears in the list it appears in most.
+         * @param other_list - list to unite with.
+         * @return A new list with the elements of both lists.
+         */
+        SortedList setUnion(const SortedList &other_list) const;
+
+        /**
+         * @brief Creates the intersection of two sorted lists in a single pass. An element which appears several
+         * times appears in the result as many times as it appears in the list it appears in least.
+         * @param other_list - list to intersect with.
+         * @return A new list with the elements that appear in both lists.
+         */
+        SortedList setIntersection(const SortedList &other_list) const;
+
+        /**
+         * @brief Creates the difference of two sorted lists in a single pass. Every appearance of an element in
+         * other_list cancels one of its appearances in this list.
+         * @param other_list - list with the elements to take out.
+         * @return A new list with the elements of this list that are not in other_list.
+         */
+        SortedList setDifference(const SortedList &other_list) const;
 
         /**
-         * @brief Removes a specific data from the list which the iterator point to.
+         * @brief Removes a specific data from the list which the iterator point to, in O(1) expected time.
+         * An iterator of another list is ignored.
          * @param iterator - iterator which points to the element we want to remove.
          * @return (void)
          * @possible_Exceptions - std::out_of_range - if the iterator is pointing outside of the list or if the
          * list is empty to begin with.
          */
-        void remove(const SortedList<T>::const_iterator &iterator);
+        void remove(const SortedList<T, Compare, KeyOf, Alloc>::const_iterator &iterator);
+
+        /**
+         * @brief Changes the element an iterator points to in place. If the change keeps the element between its
+         * neighbours nothing else happens, which takes O(1), otherwise the same node is moved to its new place in
+         * O(log n) expected time - either way no element is copied and no iterator is invalidated.
+         * An iterator of another list is ignored.
+         * @param iterator - iterator which points to the element we want to change.
+         * @param op - function that is called with a reference to the element and changes it.
+         * @return iterator to the changed element.
+         * @possible_Exceptions - std::out_of_range - if the iterator is pointing outside of the list.
+         * Any exception op throws is passed on, after the element was moved to the place its value belongs to.
+         */
+        template <class Operation>
+        const_iterator modify(const const_iterator &iterator, Operation op);
+
+        /**
+         * @brief Removes every element that fulfills a condition, in a single pass over the list. Every removed
+         * node is unlinked in O(1) expected time, no matter how many elements are removed.
+         * @param c A boolian condition, the elements that return true with it are removed.
+         * @return The number of elements removed.
+         * Any exception c throws is passed on, the elements checked before it stay removed.
+         */
+        template <class Condition>
+        int removeIf(Condition c);
+
+        /**
+         * @brief Removes the elements from first up to (not including) last, in O(number of removed elements)
+         * expected time. The range is cut out of every level at once, then its nodes are deallocated.
+         * Iterators of another list are ignored.
+         * @param first - iterator to the first element to remove.
+         * @param last - iterator past the last element to remove, the end of the list or an iterator that comes
+         * after first.
+         * @return The number of elements removed.
+         * @possible_Exceptions - std::out_of_range - if last can't be reached from first, nothing is removed then.
+         */
+        int erase(const const_iterator &first, const const_iterator &last);
         /**
         * @brief Count the number of elements in the list.
         * @return The number on element in the list.
@@ -119,6 +647,15 @@ namespace mtm
         template <class Condition>
         SortedList filter(Condition c) const;
 
+        /**
+         * @brief Filters the list like filter(c), evaluating the condition on chunks of the list in parallel.
+         * @param policy - policy which sets the number of threads.
+         * @param c A boolian condition which filters only the elements that return true with it.
+         * @return A new result list after the filter was applied.
+         */
+        template <class Condition>
+        SortedList filter(const ParallelPolicy &policy, Condition c) const;
+
         /**
          * @brief Runs over the list with a function and applies changes on the list elements and then 
          * inserts them to a new one.
@@ -128,6 +665,16 @@ namespace mtm
         template <class Operation>
         SortedList apply(Operation op);
 
+        /**
+         * @brief Applies an operation on the list like apply(op), in parallel: every thread applies op on a chunk
+         * of the list and sorts its results, then the sorted chunks are merged.
+         * @param policy - policy which sets the number of threads.
+         * @param op - A function that we apply on each element in the list.
+         * @return - A new result list with the older list elements after they went threw the function operation.
+         */
+        template <class Operation>
+        SortedList apply(const ParallelPolicy &policy, Operation op) const;
+
         /**
          * @brief begin
          * @return A const iterator that points to the first element of the list
@@ -138,35 +685,103 @@ namespace mtm
          * @return A const iterator that points to the end of the list - nullptr
          */
         const_iterator end() const;
+
+        /**
+         * @brief Creates a lazy view of the list elements that fulfill a condition. Nothing is copied or
+         * allocated - the condition is evaluated while the view is iterated, and the view can be chained with
+         * more views and collected into a new list at the end.
+         * @param c A boolian condition which filters only the elements that return true with it.
+         * @return A view over the filtered elements, valid as long as the list is not changed.
+         */
+        template <class Condition>
+        FilterView<const_iterator, Condition> filterView(Condition c) const;
+
+        /**
+         * @brief Searches the list for an element equal to data (neither of them is smaller than the other),
+         * in O(log n) expected time.
+         * @param data - data to search for.
+         * @return A const iterator that points to the first element equal to data, end() if there is none.
+         */
+        const_iterator find(const T &data) const;
+
+        /**
+         * @brief Checks if the list holds an element equal to data, in O(log n) expected time.
+         * @param data - data to search for.
+         * @return true - if an equal element is in the list, false - otherwise.
+         */
+        bool contains(const T &data) const;
+
+        /**
+         * @brief lowerBound
+         * @param data - data to search for.
+         * @return A const iterator that points to the first element which is not smaller than data.
+         */
+        const_iterator lowerBound(const T &data) const;
+
+        /**
+         * @brief upperBound
+         * @param data - data to search for.
+         * @return A const iterator that points to the first element which is bigger than data.
+         */
+        const_iterator upperBound(const T &data) const;
+
+        /**
+         * @brief Finds all the elements between two bounds, in O(log n) expected time.
+         * @param lo - lower bound of the range.
+         * @param hi - upper bound of the range.
+         * @return A pair of const iterators - the first points to the first element not smaller than lo and the
+         * second to the first element bigger than hi, so the range between them holds every lo <= element <= hi.
+         * The range is empty if hi < lo.
+         */
+        std::pair<const_iterator, const_iterator> equalRange(const T &lo, const T &hi) const;
+
+        /**
+         * @brief Finds all the elements equal to data.
+         * @param data - data to search for.
+         * @return A pair of const iterators which surrounds the elements equal to data.
+         */
+        std::pair<const_iterator, const_iterator> equalRange(const T &data) const;
+
+        /**
+         * @brief Creates a lazy view of the list elements after an operation. Nothing is copied or allocated -
+         * op is applied while the view is iterated, so its elements are not sorted until they are collected.
+         * @param op - A function that we apply on each element in the list.
+         * @return A view over the results of op, valid as long as the list is not changed.
+         */
+        template <class Operation>
+        TransformView<const_iterator, Operation> transformView(Operation op) const;
     };
 
-    template <class T>
-    class SortedList<T>::const_iterator
+    template <class T, class Compare, class KeyOf, class Alloc>
+    class SortedList<T, Compare, KeyOf, Alloc>::const_iterator
     {
         Node<T> *node;
-        int index;
+        const SortedList<T, Compare, KeyOf, Alloc> *list;
         /**
          * @brief 
          * @return Returns the pointer to the node which the iterator points to.  
          */
         Node<T> *getNode() { return this->node; }
         /**
-         * @brief Constructs a new const_iterator with a node to point to and an index to indicate it's location 
-         * in the list.
-         * @param node - node wich the iterator points to.
-         * @param index - index in the list.
+         * @brief Constructs a new const_iterator with a node to point to and the list it belongs to.
+         * @param node - node wich the iterator points to, nullptr for the end of the list.
+         * @param list - list which the iterator runs over.
          */
-        const_iterator(Node<T> *node, int index) : node(node), index(index) {}
-        friend class SortedList<T>;
+        const_iterator(Node<T> *node, const SortedList<T, Compare, KeyOf, Alloc> *list) : node(node), list(list) {}
+        friend class SortedList<T, Compare, KeyOf, Alloc>;
 
     public:
+        // the order of the list, kept by the views over it (see IteratorOrder).
+        typedef Compare compare_type;
+        typedef KeyOf key_of_type;
+
         const_iterator() = delete;
 
         /**
          * @brief Constructs a new iterator using another one's elemetns.
          * @param other_it - iterator we want to copy its elements.
          */
-        const_iterator(const SortedList<T>::const_iterator &other_it);
+        const_iterator(const SortedList<T, Compare, KeyOf, Alloc>::const_iterator &other_it);
 
         /**
          * @brief Deallocates the const_iterator.
@@ -208,201 +823,1070 @@ namespace mtm
         bool operator==(const const_iterator &it) const;
     };
 
-    template <class T>
-    SortedList<T>::SortedList()
+    template <class T, class Compare, class KeyOf, class Alloc>
+    SortedList<T, Compare, KeyOf, Alloc>::SortedList() : SortedList(Alloc())
     {
+    }
 
-        this->head = nullptr;
-        this->size = 0;
+    template <class T, class Compare, class KeyOf, class Alloc>
+    SortedList<T, Compare, KeyOf, Alloc>::SortedList(const Alloc &allocator) : levels(1), size(0), seed(level_seed),
+                                                               node_allocator(allocator), tower_allocator(allocator)
+    {
+        resetLevels();
     }
 
-    template <class T>
-    SortedList<T>::SortedList(const SortedList &sorted_list) : head(nullptr), size(empty_list)
+    template <class T, class Compare, class KeyOf, class Alloc>
+    SortedList<T, Compare, KeyOf, Alloc>::SortedList(const SortedList &sorted_list)
+        : SortedList(std::allocator_traits<Alloc>::select_on_container_copy_construction(sorted_list.getAllocator()))
     {
-        Node<T> *tmp = sorted_list.head;
+        Node<T> *tails[max_list_level];
+        findTails(tails);
+        Node<T> *tmp = sorted_list.heads[0];
 
         while (tmp != nullptr)
         {
-            this->insert(tmp->data);
+            appendNode(createNode(tmp->height, tmp->data), tails);
+            this->size++;
             tmp = tmp->next;
         }
-        this->size++;
     }
 
-    template <class T>
-    void SortedList<T>::DestroyList()
+    template <class T, class Compare, class KeyOf, class Alloc>
+    SortedList<T, Compare, KeyOf, Alloc>::SortedList(SortedList &&sorted_list) noexcept
+        : SortedList(sorted_list.getAllocator())
     {
-        Node<T> *toDelete, *tmp = this->head;
-        while (tmp != nullptr)
-        {
-            toDelete = tmp;
-            tmp = tmp->next;
-            delete toDelete;
-        }
+        swapContents(sorted_list);
     }
 
-    template <class T>
-    SortedList<T>::~SortedList()
+    template <class T, class Compare, class KeyOf, class Alloc>
+    template <class InputIterator>
+    SortedList<T, Compare, KeyOf, Alloc>::SortedList(InputIterator first, InputIterator last, const Alloc &allocator)
+        : SortedList(allocator)
     {
-        DestroyList();
+        std::vector<T> batch = sortedBatch(first, last);
+        appendSorted(std::make_move_iterator(batch.begin()), std::make_move_iterator(batch.end()));
     }
 
-    template <class T>
-    SortedList<T> &SortedList<T>::operator=(const SortedList<T> &other_list)
+    template <class T, class Compare, class KeyOf, class Alloc>
+    void SortedList<T, Compare, KeyOf, Alloc>::DestroyList()
     {
-        if(this == &other_list)
-        {
-            return *this;
-        }
-        this->size = 0;
-        DestroyList();
-        this->head = nullptr;
-        Node<T> *tmp = other_list.head;
+        Node<T> *toDelete, *tmp = this->heads[0];
         while (tmp != nullptr)
         {
-            this->insert(tmp->data);
+            toDelete = tmp;
             tmp = tmp->next;
+            destroyNode(toDelete);
         }
-        return *this;
     }
 
-    template <class T>
-    void SortedList<T>::insert(const T &data)
+    template <class T, class Compare, class KeyOf, class Alloc>
+    void SortedList<T, Compare, KeyOf, Alloc>::resetLevels()
     {
-        T copy_data = data;
-        Node<T> *new_node = new Node<T>(copy_data);
-        if (this->head == nullptr || copy_data < this->head->data)
+        for (int level = 0; level < max_list_level; level++)
         {
-            new_node->next = this->head;
-            this->head = new_node;
+            this->heads[level] = nullptr;
         }
-        else
+        this->levels = 1;
+        this->finger = nullptr;
+    }
+
+    template <class T, class Compare, class KeyOf, class Alloc>
+    int SortedList<T, Compare, KeyOf, Alloc>::randomHeight()
+    {
+        this->seed ^= this->seed << 13;
+        this->seed ^= this->seed >> 17;
+        this->seed ^= this->seed << 5;
+
+        unsigned int bits = this->seed;
+        int height = 1;
+        while ((bits & 3) == 0 && height < max_list_level)
+        {
+            height++;
+            bits >>= 2;
+        }
+        return height;
+    }
+
+    template <class T, class Compare, class KeyOf, class Alloc>
+    template <class... Args>
+    Node<T> *SortedList<T, Compare, KeyOf, Alloc>::createNode(const int height, Args &&...args)
+    {
+        Node<T> **tower = nullptr;
+        if (height > 1)
+        {
+            tower = TowerTraits::allocate(this->tower_allocator, 2 * (height - 1));
+        }
+
+        Node<T> *node = nullptr;
+        try
+        {
+            node = NodeTraits::allocate(this->node_allocator, 1);
+            NodeTraits::construct(this->node_allocator, node, height, tower, std::forward<Args>(args)...);
+            MTM_LIST_STATS(countStat(this->stats.allocations, height > 1 ? 2 : 1);)
+        }
+        catch (...)
+        {
+            if (node != nullptr)
+            {
+                NodeTraits::deallocate(this->node_allocator, node, 1);
+            }
+            if (tower != nullptr)
+            {
+                TowerTraits::deallocate(this->tower_allocator, tower, 2 * (height - 1));
+            }
+            throw;
+        }
+        return node;
+    }
+
+    template <class T, class Compare, class KeyOf, class Alloc>
+    void SortedList<T, Compare, KeyOf, Alloc>::destroyNode(Node<T> *node)
+    {
+        Node<T> **tower = node->tower;
+        int height = node->height;
+        NodeTraits::destroy(this->node_allocator, node);
+        NodeTraits::deallocate(this->node_allocator, node, 1);
+        if (tower != nullptr)
+        {
+            TowerTraits::deallocate(this->tower_allocator, tower, 2 * (height - 1));
+        }
+        MTM_LIST_STATS(countStat(this->stats.deallocations, tower != nullptr ? 2 : 1);)
+    }
+
+    template <class T, class Compare, class KeyOf, class Alloc>
+    Node<T> *&SortedList<T, Compare, KeyOf, Alloc>::link(Node<T> *pred, const int level)
+    {
+        if (pred == nullptr)
+        {
+            return this->heads[level];
+        }
+        return pred->forward(level);
+    }
+
+    template <class T, class Compare, class KeyOf, class Alloc>
+    void SortedList<T, Compare, KeyOf, Alloc>::findPredecessors(const T &data, Node<T> **update,
+                                                                const bool include_equal) const
+    {
+        Node<T> *pred = nullptr;
+        MTM_LIST_STATS(std::uint64_t steps = 0;)
+        for (int level = this->levels - 1; level >= 0; level--)
+        {
+            Node<T> *candidate = pred == nullptr ? this->heads[level] : pred->forward(level);
+            while (candidate != nullptr &&
+                   (include_equal ? !before(data, candidate->data) : before(candidate->data, data)))
+            {
+                pred = candidate;
+                candidate = candidate->forward(level);
+                MTM_LIST_STATS(steps++;)
+            }
+            update[level] = pred;
+        }
+        MTM_LIST_STATS(countStat(this->stats.nodes_traversed, steps); this->stats.search_length.record(steps);)
+    }
+
+    template <class T, class Compare, class KeyOf, class Alloc>
+    SortedList<T, Compare, KeyOf, Alloc>::~SortedList()
+    {
+        DestroyList();
+    }
+
+    template <class T, class Compare, class KeyOf, class Alloc>
+    SortedList<T, Compare, KeyOf, Alloc> &SortedList<T, Compare, KeyOf, Alloc>::operator=(const SortedList &other_list)
+    {
+        if(this == &other_list)
+        {
+            return *this;
+        }
+        SortedList<T, Compare, KeyOf, Alloc> copy(getAllocator());
+        Node<T> *tails[max_list_level];
+        copy.findTails(tails);
+        for (Node<T> *tmp = other_list.heads[0]; tmp != nullptr; tmp = tmp->next)
+        {
+            copy.appendNode(copy.createNode(tmp->height, tmp->data), tails);
+            copy.size++;
+        }
+        swapContents(copy);
+        return *this;
+    }
+
+    template <class T, class Compare, class KeyOf, class Alloc>
+    SortedList<T, Compare, KeyOf, Alloc> &SortedList<T, Compare, KeyOf, Alloc>::operator=(SortedList &&other_list) noexcept
+    {
+        if (this == &other_list)
+        {
+            return *this;
+        }
+        SortedList<T, Compare, KeyOf, Alloc> old_list(std::move(other_list));
+        swapContents(old_list);
+        return *this;
+    }
+
+    template <class T, class Compare, class KeyOf, class Alloc>
+    Node<T> *SortedList<T, Compare, KeyOf, Alloc>::findSuccessor(const T &data, const bool include_equal) const
+    {
+        MTM_LIST_STATS(countStat(this->stats.lookups); StatsTimer timer(this->stats.lookup_latency);)
+        Node<T> *update[max_list_level];
+        findPredecessors(data, update, include_equal);
+        if (update[0] == nullptr)
+        {
+            return this->heads[0];
+        }
+        return update[0]->next;
+    }
+
+    template <class T, class Compare, class KeyOf, class Alloc>
+    void SortedList<T, Compare, KeyOf, Alloc>::findTails(Node<T> **tails) const
+    {
+        Node<T> *pred = nullptr;
+        for (int level = this->levels - 1; level >= 0; level--)
+        {
+            Node<T> *candidate = pred == nullptr ? this->heads[level] : pred->forward(level);
+            while (candidate != nullptr)
+            {
+                pred = candidate;
+                candidate = candidate->forward(level);
+            }
+            tails[level] = pred;
+        }
+        for (int level = this->levels; level < max_list_level; level++)
+        {
+            tails[level] = nullptr;
+        }
+    }
+
+    template <class T, class Compare, class KeyOf, class Alloc>
+    void SortedList<T, Compare, KeyOf, Alloc>::appendNode(Node<T> *node, Node<T> **tails)
+    {
+        for (int level = 0; level < node->height; level++)
+        {
+            node->forward(level) = nullptr;
+            node->backward(level) = tails[level];
+            link(tails[level], level) = node;
+            tails[level] = node;
+        }
+        if (node->height > this->levels)
+        {
+            this->levels = node->height;
+        }
+    }
+
+    template <class T, class Compare, class KeyOf, class Alloc>
+    template <class Iterator>
+    void SortedList<T, Compare, KeyOf, Alloc>::appendSorted(Iterator first, Iterator last)
+    {
+        Node<T> *tails[max_list_level];
+        findTails(tails);
+        for (; first != last; ++first)
+        {
+            appendElement(*first, tails);
+        }
+    }
+
+    template <class T, class Compare, class KeyOf, class Alloc>
+    template <class Data>
+    void SortedList<T, Compare, KeyOf, Alloc>::appendElement(Data &&data, Node<T> **tails)
+    {
+        appendNode(createNode(randomHeight(), std::forward<Data>(data)), tails);
+        this->size++;
+    }
+
+    template <class T, class Compare, class KeyOf, class Alloc>
+    template <class InputIterator>
+    std::vector<T> SortedList<T, Compare, KeyOf, Alloc>::sortedBatch(InputIterator first, InputIterator last) const
+    {
+        std::vector<T> batch(first, last);
+        if (!std::is_sorted(batch.begin(), batch.end(), BeforeCompare(this)))
+        {
+            sortBatch(batch, UsesSortKey());
+        }
+        return batch;
+    }
+
+    template <class T, class Compare, class KeyOf, class Alloc>
+    void SortedList<T, Compare, KeyOf, Alloc>::sortBatch(std::vector<T> &batch, std::false_type) const
+    {
+        std::stable_sort(batch.begin(), batch.end(), BeforeCompare(this));
+    }
+
+    template <class T, class Compare, class KeyOf, class Alloc>
+    void SortedList<T, Compare, KeyOf, Alloc>::sortBatch(std::vector<T> &batch, std::true_type) const
+    {
+        typedef SortKeyTraits<T> Traits;
+        if (batch.size() * counting_sort_ratio < static_cast<std::size_t>(Traits::key_limit))
+        {
+            sortBatch(batch, std::false_type());
+            return;
+        }
+
+        std::vector<std::size_t> positions(Traits::key_limit + 1, 0);
+        for (typename std::vector<T>::const_iterator it = batch.begin(); it != batch.end(); ++it)
+        {
+            positions[Traits::key(*it) + 1]++;
+        }
+        for (int key = 0; key < Traits::key_limit; key++)
+        {
+            positions[key + 1] += positions[key];
+        }
+        std::vector<std::size_t> order(batch.size());
+        for (std::size_t i = 0; i < batch.size(); i++)
+        {
+            order[positions[Traits::key(batch[i])]++] = i;
+        }
+
+        std::vector<T> sorted;
+        sorted.reserve(batch.size());
+        for (std::size_t i = 0; i < order.size(); i++)
+        {
+            sorted.push_back(std::move(batch[order[i]]));
+        }
+        batch.swap(sorted);
+    }
+
+    template <class T, class Compare, class KeyOf, class Alloc>
+    void SortedList<T, Compare, KeyOf, Alloc>::swapContents(SortedList<T, Compare, KeyOf, Alloc> &other_list)
+    {
+        for (int level = 0; level < max_list_level; level++)
+        {
+            std::swap(this->heads[level], other_list.heads[level]);
+        }
+        std::swap(this->levels, other_list.levels);
+        std::swap(this->size, other_list.size);
+        std::swap(this->seed, other_list.seed);
+        std::swap(this->finger, other_list.finger);
+        std::swap(this->node_allocator, other_list.node_allocator);
+        std::swap(this->tower_allocator, other_list.tower_allocator);
+    }
+
+    template <class T, class Compare, class KeyOf, class Alloc>
+    bool SortedList<T, Compare, KeyOf, Alloc>::findNearPredecessors(const T &data, const int height, Node<T> *near,
+                                                                    Node<T> **update) const
+    {
+        if (near == nullptr)
+        {
+            return false;
+        }
+        Node<T> *pred = near;
+        int steps = 0;
+        if (before(data, near->data))
+        {
+            pred = near->prev;
+            while (pred != nullptr && before(data, pred->data))
+            {
+                if (++steps > finger_walk_limit)
+                {
+                    return false;
+                }
+                pred = pred->prev;
+            }
+        }
+        else
+        {
+            while (pred->next != nullptr && !before(data, pred->next->data))
+            {
+                if (++steps > finger_walk_limit)
+                {
+                    return false;
+                }
+                pred = pred->next;
+            }
+        }
+        MTM_LIST_STATS(countStat(this->stats.finger_hits); countStat(this->stats.nodes_traversed, steps);
+                       this->stats.search_length.record(steps);)
+
+        // the predecessor in a level is the closest node before it that is tall enough for the level, which is
+        // O(1) nodes back in expected time since each node reaches the next level with probability 1/4.
+        update[0] = pred;
+        int top = height < this->levels ? height : this->levels;
+        for (int level = 1; level < top; level++)
+        {
+            pred = update[level - 1];
+            while (pred != nullptr && pred->height <= level)
+            {
+                pred = pred->backward(level - 1);
+            }
+            update[level] = pred;
+        }
+        return true;
+    }
+
+    template <class T, class Compare, class KeyOf, class Alloc>
+    void SortedList<T, Compare, KeyOf, Alloc>::linkNode(Node<T> *new_node, Node<T> *near)
+    {
+        Node<T> *update[max_list_level];
+        int height = new_node->height;
+        if (!findNearPredecessors(new_node->data, height, near, update))
+        {
+            findPredecessors(new_node->data, update, true);
+        }
+
+        for (int level = this->levels; level < height; level++)
+        {
+            update[level] = nullptr;
+        }
+        if (height > this->levels)
+        {
+            this->levels = height;
+        }
+
+        for (int level = 0; level < height; level++)
+        {
+            Node<T> *&pred_link = link(update[level], level);
+            new_node->forward(level) = pred_link;
+            new_node->backward(level) = update[level];
+            if (pred_link != nullptr)
+            {
+                pred_link->backward(level) = new_node;
+            }
+            pred_link = new_node;
+        }
+        this->size++;
+        this->finger = new_node;
+    }
+
+    template <class T, class Compare, class KeyOf, class Alloc>
+    void SortedList<T, Compare, KeyOf, Alloc>::unlinkNode(Node<T> *node)
+    {
+        if (this->finger == node)
+        {
+            this->finger = node->prev != nullptr ? node->prev : node->next;
+        }
+        for (int level = 0; level < node->height; level++)
+        {
+            Node<T> *pred = node->backward(level), *succ = node->forward(level);
+            link(pred, level) = succ;
+            if (succ != nullptr)
+            {
+                succ->backward(level) = pred;
+            }
+        }
+        trimLevels();
+        this->size--;
+    }
+
+    template <class T, class Compare, class KeyOf, class Alloc>
+    void SortedList<T, Compare, KeyOf, Alloc>::trimLevels()
+    {
+        while (this->levels > 1 && this->heads[this->levels - 1] == nullptr)
+        {
+            this->levels--;
+        }
+    }
+
+    template <class T, class Compare, class KeyOf, class Alloc>
+    typename SortedList<T, Compare, KeyOf, Alloc>::const_iterator
+    SortedList<T, Compare, KeyOf, Alloc>::insert(const T &data)
+    {
+        return emplace(data);
+    }
+
+    template <class T, class Compare, class KeyOf, class Alloc>
+    typename SortedList<T, Compare, KeyOf, Alloc>::const_iterator SortedList<T, Compare, KeyOf, Alloc>::insert(T &&data)
+    {
+        return emplace(std::move(data));
+    }
+
+    template <class T, class Compare, class KeyOf, class Alloc>
+    template <class... Args>
+    typename SortedList<T, Compare, KeyOf, Alloc>::const_iterator
+    SortedList<T, Compare, KeyOf, Alloc>::emplace(Args &&...args)
+    {
+        MTM_LIST_STATS(countStat(this->stats.inserts); StatsTimer timer(this->stats.insert_latency);)
+        Node<T> *new_node = createNode(randomHeight(), std::forward<Args>(args)...);
+        linkNode(new_node, this->finger);
+        return const_iterator(new_node, this);
+    }
+
+    template <class T, class Compare, class KeyOf, class Alloc>
+    typename SortedList<T, Compare, KeyOf, Alloc>::const_iterator
+    SortedList<T, Compare, KeyOf, Alloc>::insert(const const_iterator &hint, const T &data)
+    {
+        return emplaceHint(hint, data);
+    }
+
+    template <class T, class Compare, class KeyOf, class Alloc>
+    typename SortedList<T, Compare, KeyOf, Alloc>::const_iterator
+    SortedList<T, Compare, KeyOf, Alloc>::insert(const const_iterator &hint, T &&data)
+    {
+        return emplaceHint(hint, std::move(data));
+    }
+
+    template <class T, class Compare, class KeyOf, class Alloc>
+    template <class... Args>
+    typename SortedList<T, Compare, KeyOf, Alloc>::const_iterator
+    SortedList<T, Compare, KeyOf, Alloc>::emplaceHint(const const_iterator &hint, Args &&...args)
+    {
+        MTM_LIST_STATS(countStat(this->stats.inserts); StatsTimer timer(this->stats.insert_latency);)
+        Node<T> *new_node = createNode(randomHeight(), std::forward<Args>(args)...);
+        Node<T> *near = hint.list == this && hint.node != nullptr ? hint.node : this->finger;
+        linkNode(new_node, near);
+        return const_iterator(new_node, this);
+    }
+
+    template <class T, class Compare, class KeyOf, class Alloc>
+    template <class InputIterator>
+    void SortedList<T, Compare, KeyOf, Alloc>::assign(InputIterator first, InputIterator last)
+    {
+        SortedList<T, Compare, KeyOf, Alloc> result(first, last, getAllocator());
+        swapContents(result);
+    }
+
+    template <class T, class Compare, class KeyOf, class Alloc>
+    template <class InputIterator>
+    void SortedList<T, Compare, KeyOf, Alloc>::insertRange(InputIterator first, InputIterator last)
+    {
+        std::vector<T> batch = sortedBatch(first, last);
+        MTM_LIST_STATS(countStat(this->stats.bulk_inserts); countStat(this->stats.bulk_elements, batch.size());)
+        if (batch.size() * bulk_insert_ratio < static_cast<std::size_t>(this->size))
+        {
+            for (typename std::vector<T>::iterator it = batch.begin(); it != batch.end(); ++it)
+            {
+                insert(std::move(*it));
+            }
+            return;
+        }
+
+        std::vector<Node<T> *> new_nodes;
+        new_nodes.reserve(batch.size());
+        try
+        {
+            for (typename std::vector<T>::iterator it = batch.begin(); it != batch.end(); ++it)
+            {
+                new_nodes.push_back(createNode(randomHeight(), std::move(*it)));
+            }
+        }
+        catch (...)
+        {
+            for (typename std::vector<Node<T> *>::iterator it = new_nodes.begin(); it != new_nodes.end(); ++it)
+            {
+                destroyNode(*it);
+            }
+            throw;
+        }
+
+        // both chains are sorted, so one merging pass relinks every level of the list.
+        Node<T> *old_node = this->heads[0];
+        Node<T> *tails[max_list_level];
+        resetLevels();
+        findTails(tails);
+        typename std::vector<Node<T> *>::iterator new_node = new_nodes.begin();
+        while (old_node != nullptr || new_node != new_nodes.end())
+        {
+            if (new_node == new_nodes.end() || (old_node != nullptr && !before((*new_node)->data, old_node->data)))
+            {
+                Node<T> *next = old_node->next;
+                appendNode(old_node, tails);
+                old_node = next;
+            }
+            else
+            {
+                appendNode(*new_node, tails);
+                ++new_node;
+            }
+        }
+        this->size += static_cast<int>(new_nodes.size());
+    }
+
+    template <class T, class Compare, class KeyOf, class Alloc>
+    void SortedList<T, Compare, KeyOf, Alloc>::merge(SortedList<T, Compare, KeyOf, Alloc> &&other_list)
+    {
+        if (this == &other_list)
+        {
+            return;
+        }
+        if (getAllocator() != other_list.getAllocator())
+        {
+            // nodes of another allocator can't be relinked here, so their elements are moved into new nodes.
+            SortedList<T, Compare, KeyOf, Alloc> moved_list(getAllocator());
+            Node<T> *tails[max_list_level];
+            moved_list.findTails(tails);
+            for (Node<T> *tmp = other_list.heads[0]; tmp != nullptr; tmp = tmp->next)
+            {
+                moved_list.appendElement(std::move(tmp->data), tails);
+            }
+            SortedList<T, Compare, KeyOf, Alloc> discarded_list(std::move(other_list));
+            merge(std::move(moved_list));
+            return;
+        }
+
+        Node<T> *node = this->heads[0], *other_node = other_list.heads[0];
+        Node<T> *tails[max_list_level];
+        resetLevels();
+        other_list.resetLevels();
+        findTails(tails);
+        while (node != nullptr || other_node != nullptr)
+        {
+            if (other_node == nullptr || (node != nullptr && !before(other_node->data, node->data)))
+            {
+                Node<T> *next = node->next;
+                appendNode(node, tails);
+                node = next;
+            }
+            else
+            {
+                Node<T> *next = other_node->next;
+                appendNode(other_node, tails);
+                other_node = next;
+            }
+        }
+        this->size += other_list.size;
+        other_list.size = 0;
+    }
+
+    template <class T, class Compare, class KeyOf, class Alloc>
+    SortedList<T, Compare, KeyOf, Alloc>
+    SortedList<T, Compare, KeyOf, Alloc>::setUnion(const SortedList &other_list) const
+    {
+        SortedList<T, Compare, KeyOf, Alloc> result(getAllocator());
+        Node<T> *tails[max_list_level];
+        result.findTails(tails);
+        Node<T> *node = this->heads[0], *other_node = other_list.heads[0];
+        while (node != nullptr && other_node != nullptr)
+        {
+            if (before(node->data, other_node->data))
+            {
+                result.appendElement(node->data, tails);
+                node = node->next;
+            }
+            else if (before(other_node->data, node->data))
+            {
+                result.appendElement(other_node->data, tails);
+                other_node = other_node->next;
+            }
+            else
+            {
+                result.appendElement(node->data, tails);
+                node = node->next;
+                other_node = other_node->next;
+            }
+        }
+        for (; node != nullptr; node = node->next)
+        {
+            result.appendElement(node->data, tails);
+        }
+        for (; other_node != nullptr; other_node = other_node->next)
+        {
+            result.appendElement(other_node->data, tails);
+        }
+        return result;
+    }
+
+    template <class T, class Compare, class KeyOf, class Alloc>
+    SortedList<T, Compare, KeyOf, Alloc>
+    SortedList<T, Compare, KeyOf, Alloc>::setIntersection(const SortedList &other_list) const
+    {
+        SortedList<T, Compare, KeyOf, Alloc> result(getAllocator());
+        Node<T> *tails[max_list_level];
+        result.findTails(tails);
+        Node<T> *node = this->heads[0], *other_node = other_list.heads[0];
+        while (node != nullptr && other_node != nullptr)
+        {
+            if (before(node->data, other_node->data))
+            {
+                node = node->next;
+            }
+            else if (before(other_node->data, node->data))
+            {
+                other_node = other_node->next;
+            }
+            else
+            {
+                result.appendElement(node->data, tails);
+                node = node->next;
+                other_node = other_node->next;
+            }
+        }
+        return result;
+    }
+
+    template <class T, class Compare, class KeyOf, class Alloc>
+    SortedList<T, Compare, KeyOf, Alloc>
+    SortedList<T, Compare, KeyOf, Alloc>::setDifference(const SortedList &other_list) const
+    {
+        SortedList<T, Compare, KeyOf, Alloc> result(getAllocator());
+        Node<T> *tails[max_list_level];
+        result.findTails(tails);
+        Node<T> *node = this->heads[0], *other_node = other_list.heads[0];
+        while (node != nullptr && other_node != nullptr)
+        {
+            if (before(node->data, other_node->data))
+            {
+                result.appendElement(node->data, tails);
+                node = node->next;
+            }
+            else if (before(other_node->data, node->data))
+            {
+                other_node = other_node->next;
+            }
+            else
+            {
+                node = node->next;
+                other_node = other_node->next;
+            }
+        }
+        for (; node != nullptr; node = node->next)
+        {
+            result.appendElement(node->data, tails);
+        }
+        return result;
+    }
+
+    template <class T, class Compare, class KeyOf, class Alloc>
+    void SortedList<T, Compare, KeyOf, Alloc>::remove(const const_iterator &iterator)
+    {
+        if(iterator.node == nullptr){
+            throw std::out_of_range(out_of_range_error);
+        }
+        
+        if(iterator.list != this){
+            return;
+        }
+        MTM_LIST_STATS(countStat(this->stats.removes); StatsTimer timer(this->stats.remove_latency);)
+
+        Node<T> *to_remove = iterator.node;
+        unlinkNode(to_remove);
+        destroyNode(to_remove);
+    }
+
+    template <class T, class Compare, class KeyOf, class Alloc>
+    template <class Condition>
+    int SortedList<T, Compare, KeyOf, Alloc>::removeIf(Condition c)
+    {
+        int removed = 0;
+        Node<T> *node = this->heads[0];
+        while (node != nullptr)
+        {
+            Node<T> *next = node->next;
+            if (c(node->data))
+            {
+                unlinkNode(node);
+                destroyNode(node);
+                removed++;
+            }
+            node = next;
+        }
+        MTM_LIST_STATS(countStat(this->stats.removes, removed);)
+        return removed;
+    }
+
+    template <class T, class Compare, class KeyOf, class Alloc>
+    int SortedList<T, Compare, KeyOf, Alloc>::erase(const const_iterator &first, const const_iterator &last)
+    {
+        if (first == last || first.list != this || last.list != this)
+        {
+            return 0;
+        }
+
+        // the first and last node of the range in each level, found before the list is changed at all.
+        Node<T> *level_first[max_list_level], *level_last[max_list_level];
+        int top = 0, removed = 0;
+        for (Node<T> *node = first.node; node != last.node; node = node->next)
         {
-            Node<T> *ptr = this->head;
-            while (ptr->next != nullptr)
+            if (node == nullptr)
+            {
+                throw std::out_of_range(out_of_range_error);
+            }
+            for (int level = 0; level < node->height; level++)
             {
-                if (copy_data < ptr->next->data)
+                if (level >= top)
                 {
-                    new_node->next = ptr->next;
-                    ptr->next = new_node;
-                    this->size++;
-                    return;
+                    level_first[level] = node;
                 }
-                ptr = ptr->next;
+                level_last[level] = node;
             }
+            top = std::max(top, node->height);
+            removed++;
+        }
+
+        for (int level = 0; level < top; level++)
+        {
+            Node<T> *pred = level_first[level]->backward(level), *succ = level_last[level]->forward(level);
+            link(pred, level) = succ;
+            if (succ != nullptr)
+            {
+                succ->backward(level) = pred;
+            }
+        }
+        trimLevels();
+        this->size -= removed;
+        this->finger = last.node != nullptr ? last.node : first.node->prev;
 
-            new_node->next = ptr->next;
-            ptr->next = new_node;
+        // the removed nodes still point to each other in level 0.
+        for (Node<T> *node = first.node; node != last.node;)
+        {
+            Node<T> *next = node->next;
+            destroyNode(node);
+            node = next;
         }
-        this->size++;
+        MTM_LIST_STATS(countStat(this->stats.removes, removed);)
+        return removed;
     }
 
-    template <class T>
-    void SortedList<T>::remove(const SortedList<T>::const_iterator &iterator)
+    template <class T, class Compare, class KeyOf, class Alloc>
+    template <class Operation>
+    typename SortedList<T, Compare, KeyOf, Alloc>::const_iterator
+    SortedList<T, Compare, KeyOf, Alloc>::modify(const const_iterator &iterator, Operation op)
     {
-        if(iterator.node == nullptr){
+        if (iterator.node == nullptr)
+        {
             throw std::out_of_range(out_of_range_error);
         }
-        
-        if(this->head == nullptr){
-            return;
+        if (iterator.list != this)
+        {
+            return iterator;
         }
 
-        SortedList<T>::const_iterator prev = begin();
-        if (prev == iterator)
+        Node<T> *node = iterator.node;
+        try
         {
-            Node<T> *tmp = this->head;
-            this->head = this->head->next;
-            delete tmp;
-            this->size--;
-            return;
+            op(node->data);
         }
+        catch (...)
+        {
+            relinkNode(node);
+            throw;
+        }
+        relinkNode(node);
+        return iterator;
+    }
 
-        for (SortedList<T>::const_iterator it = begin(); !(it == end()); ++it)
+    template <class T, class Compare, class KeyOf, class Alloc>
+    void SortedList<T, Compare, KeyOf, Alloc>::relinkNode(Node<T> *node)
+    {
+        if ((node->prev == nullptr || !before(node->data, node->prev->data)) &&
+            (node->next == nullptr || !before(node->next->data, node->data)))
         {
-            if (it == iterator)
-            {
-                prev.getNode()->next = it.getNode()->next;
-                delete it.getNode();
-                this->size--;
-                return;
-            }
-            prev = it;
+            return;
         }
+        Node<T> *near = node->prev != nullptr ? node->prev : node->next;
+        unlinkNode(node);
+        linkNode(node, near);
     }
 
-    template <class T>
-    int SortedList<T>::length() const
+    template <class T, class Compare, class KeyOf, class Alloc>
+    Alloc SortedList<T, Compare, KeyOf, Alloc>::getAllocator() const
+    {
+        return Alloc(this->node_allocator);
+    }
+
+    template <class T, class Compare, class KeyOf, class Alloc>
+    void SortedList<T, Compare, KeyOf, Alloc>::dropNodes()
+    {
+        static_assert(std::is_trivially_destructible<T>::value,
+                      "dropNodes skips the destructors of the elements - use it only when they do nothing");
+        resetLevels();
+        this->size = 0;
+    }
+
+#ifdef MTM_SORTED_LIST_STATS
+    template <class T, class Compare, class KeyOf, class Alloc>
+    const ListStats &SortedList<T, Compare, KeyOf, Alloc>::getStats() const
+    {
+        return this->stats;
+    }
+
+    template <class T, class Compare, class KeyOf, class Alloc>
+    void SortedList<T, Compare, KeyOf, Alloc>::resetStats() const
+    {
+        this->stats.reset();
+    }
+#endif
+
+    template <class T, class Compare, class KeyOf, class Alloc>
+    int SortedList<T, Compare, KeyOf, Alloc>::length() const
     {
         return this->size;
     }
 
-    template <class T>
+    template <class T, class Compare, class KeyOf, class Alloc>
     template <class Condition>
-    SortedList<T> SortedList<T>::filter(Condition c) const
+    SortedList<T, Compare, KeyOf, Alloc> SortedList<T, Compare, KeyOf, Alloc>::filter(Condition c) const
     {
-        SortedList<T> result;
-        for (SortedList<T>::const_iterator it = begin(); !(it == end()); ++it)
+        SortedList<T, Compare, KeyOf, Alloc> result(getAllocator());
+        Node<T> *tails[max_list_level];
+        result.findTails(tails);
+        for (SortedList<T, Compare, KeyOf, Alloc>::const_iterator it = begin(); !(it == end()); ++it)
         {
             if (c(*it))
             {
-                result.insert(*it);
+                result.appendElement(*it, tails);
             }
         }
         return result;
     }
 
-    template <class T>
+    template <class T, class Compare, class KeyOf, class Alloc>
+    template <class Condition>
+    SortedList<T, Compare, KeyOf, Alloc>
+    SortedList<T, Compare, KeyOf, Alloc>::filter(const ParallelPolicy &policy, Condition c) const
+    {
+        std::vector<char> keep(this->size);
+        forEachChunk(policy, [&keep, &c](int, Node<T> *node, int count, int offset) {
+            for (int i = 0; i < count; i++, node = node->next)
+            {
+                keep[offset + i] = c(node->data) ? 1 : 0;
+            }
+        });
+
+        SortedList<T, Compare, KeyOf, Alloc> result(getAllocator());
+        Node<T> *tails[max_list_level];
+        result.findTails(tails);
+        int index = 0;
+        for (Node<T> *node = this->heads[0]; node != nullptr; node = node->next, index++)
+        {
+            if (keep[index])
+            {
+                result.appendElement(node->data, tails);
+            }
+        }
+        return result;
+    }
+
+    template <class T, class Compare, class KeyOf, class Alloc>
     template <class Operation>
-    SortedList<T> SortedList<T>::apply(Operation op)
+    SortedList<T, Compare, KeyOf, Alloc> SortedList<T, Compare, KeyOf, Alloc>::apply(Operation op)
     {
-        SortedList<T> result;
-        for (SortedList<T>::const_iterator it = begin(); !(it == end()); ++it)
+        SortedList<T, Compare, KeyOf, Alloc> result(getAllocator());
+        for (SortedList<T, Compare, KeyOf, Alloc>::const_iterator it = begin(); !(it == end()); ++it)
         {
             result.insert(op(*it));
         }
         return result;
     }
 
-    template <class T>
-    typename SortedList<T>::const_iterator SortedList<T>::begin() const
+    template <class T, class Compare, class KeyOf, class Alloc>
+    template <class Operation>
+    SortedList<T, Compare, KeyOf, Alloc>
+    SortedList<T, Compare, KeyOf, Alloc>::apply(const ParallelPolicy &policy, Operation op) const
     {
-        if (this->head == nullptr)
+        std::vector<std::vector<T>> results(policy.threadCount());
+        int chunks = forEachChunk(policy, [this, &results, &op](int chunk, Node<T> *node, int count, int) {
+            std::vector<T> &chunk_results = results[chunk];
+            chunk_results.reserve(count);
+            for (int i = 0; i < count; i++, node = node->next)
+            {
+                chunk_results.push_back(op(node->data));
+            }
+            if (!std::is_sorted(chunk_results.begin(), chunk_results.end(), BeforeCompare(this)))
+            {
+                sortBatch(chunk_results, UsesSortKey());
+            }
+        });
+
+        std::vector<SortedList<T, Compare, KeyOf, Alloc>> parts;
+        parts.reserve(chunks);
+        for (int chunk = 0; chunk < chunks; chunk++)
+        {
+            parts.push_back(SortedList<T, Compare, KeyOf, Alloc>(getAllocator()));
+            parts.back().appendSorted(std::make_move_iterator(results[chunk].begin()),
+                                      std::make_move_iterator(results[chunk].end()));
+            std::vector<T>().swap(results[chunk]);
+        }
+
+        // merging neighbours keeps equal results in the order of the elements they came from.
+        for (std::size_t step = 1; step < parts.size(); step *= 2)
+        {
+            for (std::size_t i = 0; i + step < parts.size(); i += 2 * step)
+            {
+                parts[i].merge(std::move(parts[i + step]));
+            }
+        }
+        if (parts.empty())
         {
-            return const_iterator(this->head, empty_list);
+            return SortedList<T, Compare, KeyOf, Alloc>(getAllocator());
         }
-        return const_iterator(this->head, empty_list + 1);
+        return std::move(parts[0]);
     }
 
-    template <class T>
-    typename SortedList<T>::const_iterator SortedList<T>::end() const
+    template <class T, class Compare, class KeyOf, class Alloc>
+    template <class Task>
+    int SortedList<T, Compare, KeyOf, Alloc>::forEachChunk(const ParallelPolicy &policy, Task task) const
     {
-        Node<T> *tmp = this->head;
-        if (tmp == nullptr)
+        int chunks = static_cast<int>(std::min<unsigned int>(policy.threadCount(), this->size));
+        if (chunks <= 1)
         {
-            return const_iterator(tmp, empty_list);
+            if (this->size > 0)
+            {
+                task(0, this->heads[0], this->size, 0);
+            }
+            return this->size > 0 ? 1 : 0;
         }
 
-        while (tmp->next != nullptr)
+        std::vector<Node<T> *> starts(chunks);
+        std::vector<int> offsets(chunks + 1);
+        Node<T> *node = this->heads[0];
+        for (int chunk = 0; chunk < chunks; chunk++)
         {
-            tmp = tmp->next;
+            offsets[chunk] = static_cast<int>(static_cast<long long>(this->size) * chunk / chunks);
+            offsets[chunk + 1] = static_cast<int>(static_cast<long long>(this->size) * (chunk + 1) / chunks);
+            starts[chunk] = node;
+            for (int i = offsets[chunk]; i < offsets[chunk + 1]; i++)
+            {
+                node = node->next;
+            }
+        }
+
+        std::vector<std::exception_ptr> errors(chunks);
+        std::vector<std::thread> workers;
+        workers.reserve(chunks - 1);
+        for (int chunk = 0; chunk < chunks; chunk++)
+        {
+            auto run = [&, chunk]() {
+                try
+                {
+                    task(chunk, starts[chunk], offsets[chunk + 1] - offsets[chunk], offsets[chunk]);
+                }
+                catch (...)
+                {
+                    errors[chunk] = std::current_exception();
+                }
+            };
+            if (chunk == chunks - 1)
+            {
+                run();
+            }
+            else
+            {
+                workers.push_back(std::thread(run));
+            }
+        }
+        for (std::size_t i = 0; i < workers.size(); i++)
+        {
+            workers[i].join();
+        }
+        for (int chunk = 0; chunk < chunks; chunk++)
+        {
+            if (errors[chunk])
+            {
+                std::rethrow_exception(errors[chunk]);
+            }
         }
+        return chunks;
+    }
+
+    template <class T, class Compare, class KeyOf, class Alloc>
+    typename SortedList<T, Compare, KeyOf, Alloc>::const_iterator SortedList<T, Compare, KeyOf, Alloc>::begin() const
+    {
+        return const_iterator(this->heads[0], this);
+    }
 
-        return const_iterator(tmp->next, this->size);
+    template <class T, class Compare, class KeyOf, class Alloc>
+    typename SortedList<T, Compare, KeyOf, Alloc>::const_iterator SortedList<T, Compare, KeyOf, Alloc>::end() const
+    {
+        return const_iterator(nullptr, this);
     }
 
     /*==============================ITERATOR CLASS==============================*/
-    template <class T>
-    SortedList<T>::const_iterator::const_iterator(const SortedList<T>::const_iterator &other_it)
+    template <class T, class Compare, class KeyOf, class Alloc>
+    SortedList<T, Compare, KeyOf, Alloc>::const_iterator::const_iterator(const const_iterator &other_it)
     {
         this->node = other_it.node;
-        this->index = other_it.index;
+        this->list = other_it.list;
     }
 
-    template <class T>
-    bool SortedList<T>::const_iterator::operator==(const const_iterator &other_iter) const
+    template <class T, class Compare, class KeyOf, class Alloc>
+    bool SortedList<T, Compare, KeyOf, Alloc>::const_iterator::operator==(const const_iterator &other_iter) const
     {
-        if (this->index == other_iter.index)
+        if (this->node == other_iter.node)
         {
             return true;
         }
@@ -410,8 +1894,8 @@ namespace mtm
         return false;
     }
 
-    template <class T>
-    const T &SortedList<T>::const_iterator::operator*() const
+    template <class T, class Compare, class KeyOf, class Alloc>
+    const T &SortedList<T, Compare, KeyOf, Alloc>::const_iterator::operator*() const
     {
         if (this->node == nullptr)
         {
@@ -421,30 +1905,353 @@ namespace mtm
         return this->node->data;
     }
 
-    template <class T>
-    typename SortedList<T>::const_iterator &SortedList<T>::const_iterator::operator++()
+    template <class T, class Compare, class KeyOf, class Alloc>
+    typename SortedList<T, Compare, KeyOf, Alloc>::const_iterator &
+    SortedList<T, Compare, KeyOf, Alloc>::const_iterator::operator++()
     {
         if (this->node == nullptr)
         {
             throw std::out_of_range(out_of_range_error);
         }
 
+        MTM_LIST_STATS(countStat(this->list->stats.iterator_steps);)
         this->node = this->node->next;
-        this->index++;
         return *this;
     }
 
-    template <class T>
-    typename SortedList<T>::const_iterator SortedList<T>::const_iterator::operator++(int)
+    template <class T, class Compare, class KeyOf, class Alloc>
+    typename SortedList<T, Compare, KeyOf, Alloc>::const_iterator
+    SortedList<T, Compare, KeyOf, Alloc>::const_iterator::operator++(int)
     {
-        if (this->node == nullptr)
-        {
-            throw std::out_of_range(out_of_range_error);
-        }
         const_iterator result = *this;
-        this->node = this->node->next;
-        this->index++;
+        ++*this;
         return result;
     }
+
+    template <class T, class Compare, class KeyOf, class Alloc>
+    typename SortedList<T, Compare, KeyOf, Alloc>::const_iterator
+    SortedList<T, Compare, KeyOf, Alloc>::find(const T &data) const
+    {
+        Node<T> *node = findSuccessor(data, false);
+        if (node == nullptr || before(data, node->data))
+        {
+            return end();
+        }
+        return const_iterator(node, this);
+    }
+
+    template <class T, class Compare, class KeyOf, class Alloc>
+    bool SortedList<T, Compare, KeyOf, Alloc>::contains(const T &data) const
+    {
+        return !(find(data) == end());
+    }
+
+    template <class T, class Compare, class KeyOf, class Alloc>
+    typename SortedList<T, Compare, KeyOf, Alloc>::const_iterator
+    SortedList<T, Compare, KeyOf, Alloc>::lowerBound(const T &data) const
+    {
+        return const_iterator(findSuccessor(data, false), this);
+    }
+
+    template <class T, class Compare, class KeyOf, class Alloc>
+    typename SortedList<T, Compare, KeyOf, Alloc>::const_iterator
+    SortedList<T, Compare, KeyOf, Alloc>::upperBound(const T &data) const
+    {
+        return const_iterator(findSuccessor(data, true), this);
+    }
+
+    template <class T, class Compare, class KeyOf, class Alloc>
+    std::pair<typename SortedList<T, Compare, KeyOf, Alloc>::const_iterator,
+              typename SortedList<T, Compare, KeyOf, Alloc>::const_iterator>
+    SortedList<T, Compare, KeyOf, Alloc>::equalRange(const T &lo, const T &hi) const
+    {
+        const_iterator range_first = lowerBound(lo);
+        return std::make_pair(range_first, before(hi, lo) ? range_first : upperBound(hi));
+    }
+
+    template <class T, class Compare, class KeyOf, class Alloc>
+    std::pair<typename SortedList<T, Compare, KeyOf, Alloc>::const_iterator,
+              typename SortedList<T, Compare, KeyOf, Alloc>::const_iterator>
+    SortedList<T, Compare, KeyOf, Alloc>::equalRange(const T &data) const
+    {
+        return equalRange(data, data);
+    }
+
+    template <class T, class Compare, class KeyOf, class Alloc>
+    template <class Condition>
+    FilterView<typename SortedList<T, Compare, KeyOf, Alloc>::const_iterator, Condition>
+    SortedList<T, Compare, KeyOf, Alloc>::filterView(Condition c) const
+    {
+        return FilterView<const_iterator, Condition>(begin(), end(), c);
+    }
+
+    template <class T, class Compare, class KeyOf, class Alloc>
+    template <class Operation>
+    TransformView<typename SortedList<T, Compare, KeyOf, Alloc>::const_iterator, Operation>
+    SortedList<T, Compare, KeyOf, Alloc>::transformView(Operation op) const
+    {
+        return TransformView<const_iterator, Operation>(begin(), end(), op);
+    }
+
+    /*==============================VIEW CLASSES==============================*/
+    template <class Type>
+    class VoidType
+    {
+    public:
+        typedef void type;
+    };
+
+    /*
+     * The order the elements of an iterator come in, which a collected view keeps. Iterators of a SortedList (and
+     * filters over them) carry the Compare and KeyOf of their list, any other iterator stands for the natural
+     * order of its elements.
+     */
+    template <class Iterator, class = void>
+    class IteratorOrder
+    {
+        typedef typename std::decay<decltype(*std::declval<const Iterator &>())>::type value_type;
+
+    public:
+        typedef std::less<value_type> compare_type;
+        typedef IdentityKey<value_type> key_of_type;
+    };
+
+    template <class Iterator>
+    class IteratorOrder<Iterator, typename VoidType<typename Iterator::compare_type>::type>
+    {
+    public:
+        typedef typename Iterator::compare_type compare_type;
+        typedef typename Iterator::key_of_type key_of_type;
+    };
+
+    /**
+     * collectView - copies the elements of a view into a new sorted list, sorting them once. Elements that
+     * already come in the order of the list are linked in O(n).
+     * @param first - iterator to the first element of the view.
+     * @param last - iterator to the end of the view.
+     * @param allocator - allocator of the new list.
+     * @return A new list with the view elements.
+     */
+    template <class Value, class Compare, class KeyOf, class Alloc, class Iterator>
+    SortedList<Value, Compare, KeyOf, Alloc> collectView(Iterator first, const Iterator &last, const Alloc &allocator)
+    {
+        std::vector<Value> elements;
+        for (; !(first == last); ++first)
+        {
+            elements.push_back(*first);
+        }
+        return SortedList<Value, Compare, KeyOf, Alloc>(std::make_move_iterator(elements.begin()),
+                                                        std::make_move_iterator(elements.end()), allocator);
+    }
+
+    template <class Iterator, class Condition>
+    class FilterView
+    {
+        Iterator first;
+        Iterator last;
+        Condition c;
+
+    public:
+        typedef decltype(*std::declval<const Iterator &>()) reference;
+        typedef typename std::decay<reference>::type value_type;
+        // a filter keeps the order of the elements it runs over.
+        typedef typename IteratorOrder<Iterator>::compare_type compare_type;
+        typedef typename IteratorOrder<Iterator>::key_of_type key_of_type;
+
+        /**
+         * @brief iterator over the elements of the view, skips the elements that don't fulfill the condition.
+         */
+        class const_iterator
+        {
+            Iterator current;
+            Iterator last;
+            Condition c;
+
+            /**
+             * @brief advances current to the first element from it that fulfills the condition.
+             * @return (void)
+             */
+            void skip()
+            {
+                while (!(this->current == this->last) && !this->c(*this->current))
+                {
+                    ++this->current;
+                }
+            }
+
+        public:
+            typedef typename FilterView::compare_type compare_type;
+            typedef typename FilterView::key_of_type key_of_type;
+
+            const_iterator(const Iterator &current, const Iterator &last, const Condition &c)
+                : current(current), last(last), c(c)
+            {
+                skip();
+            }
+
+            /**
+             * @return Returns the element which the iterator points to.
+             * @possivle_Exceptions - std::out_of_range - if the iterator points to the end of the view.
+             */
+            reference operator*() const { return *this->current; }
+
+            const_iterator &operator++()
+            {
+                ++this->current;
+                skip();
+                return *this;
+            }
+
+            const_iterator operator++(int)
+            {
+                const_iterator result = *this;
+                ++*this;
+                return result;
+            }
+
+            bool operator==(const const_iterator &it) const { return this->current == it.current; }
+        };
+
+        /**
+         * @brief Constructs a view over the elements between first and last that fulfill c.
+         * @param first - iterator to the first element to filter.
+         * @param last - iterator to the end of the elements.
+         * @param c A boolian condition which filters only the elements that return true with it.
+         */
+        FilterView(const Iterator &first, const Iterator &last, const Condition &c) : first(first), last(last), c(c)
+        {
+        }
+
+        const_iterator begin() const { return const_iterator(this->first, this->last, this->c); }
+        const_iterator end() const { return const_iterator(this->last, this->last, this->c); }
+
+        /**
+         * @brief Chains another filter after this view.
+         * @param c A boolian condition which filters only the elements that return true with it.
+         * @return A view over the elements of this view that fulfill c.
+         */
+        template <class NextCondition>
+        FilterView<const_iterator, NextCondition> filterView(NextCondition c) const
+        {
+            return FilterView<const_iterator, NextCondition>(begin(), end(), c);
+        }
+
+        /**
+         * @brief Chains an operation after this view.
+         * @param op - A function that we apply on each element of the view.
+         * @return A view over the results of op.
+         */
+        template <class Operation>
+        TransformView<const_iterator, Operation> transformView(Operation op) const
+        {
+            return TransformView<const_iterator, Operation>(begin(), end(), op);
+        }
+
+        /**
+         * @brief Copies the elements of the view into a new list - the only step of a view chain that allocates.
+         * The new list keeps the order of the filtered list, so its elements are linked without sorting them.
+         * @param allocator - allocator of the new list.
+         * @return A new list with the view elements.
+         */
+        template <class Alloc = std::allocator<value_type>>
+        SortedList<value_type, compare_type, key_of_type, Alloc> collect(const Alloc &allocator = Alloc()) const
+        {
+            return collectView<value_type, compare_type, key_of_type>(begin(), end(), allocator);
+        }
+    };
+
+    template <class Iterator, class Operation>
+    class TransformView
+    {
+        Iterator first;
+        Iterator last;
+        Operation op;
+
+    public:
+        typedef decltype(std::declval<const Operation &>()(*std::declval<const Iterator &>())) reference;
+        typedef typename std::decay<reference>::type value_type;
+
+        /**
+         * @brief iterator over the elements of the view, applies the operation on every element it reaches.
+         */
+        class const_iterator
+        {
+            Iterator current;
+            Operation op;
+
+        public:
+            const_iterator(const Iterator &current, const Operation &op) : current(current), op(op) {}
+
+            /**
+             * @return Returns the result of the operation on the element which the iterator points to.
+             * @possivle_Exceptions - std::out_of_range - if the iterator points to the end of the view.
+             */
+            reference operator*() const { return this->op(*this->current); }
+
+            const_iterator &operator++()
+            {
+                ++this->current;
+                return *this;
+            }
+
+            const_iterator operator++(int)
+            {
+                const_iterator result = *this;
+                ++this->current;
+                return result;
+            }
+
+            bool operator==(const const_iterator &it) const { return this->current == it.current; }
+        };
+
+        /**
+         * @brief Constructs a view over the results of op on the elements between first and last.
+         * @param first - iterator to the first element.
+         * @param last - iterator to the end of the elements.
+         * @param op - A function that we apply on each element.
+         */
+        TransformView(const Iterator &first, const Iterator &last, const Operation &op)
+            : first(first), last(last), op(op)
+        {
+        }
+
+        const_iterator begin() const { return const_iterator(this->first, this->op); }
+        const_iterator end() const { return const_iterator(this->last, this->op); }
+
+        /**
+         * @brief Chains a filter after this view.
+         * @param c A boolian condition which filters only the elements that return true with it.
+         * @return A view over the elements of this view that fulfill c.
+         */
+        template <class Condition>
+        FilterView<const_iterator, Condition> filterView(Condition c) const
+        {
+            return FilterView<const_iterator, Condition>(begin(), end(), c);
+        }
+
+        /**
+         * @brief Chains another operation after this view.
+         * @param op - A function that we apply on each element of the view.
+         * @return A view over the results of op.
+         */
+        template <class NextOperation>
+        TransformView<const_iterator, NextOperation> transformView(NextOperation op) const
+        {
+            return TransformView<const_iterator, NextOperation>(begin(), end(), op);
+        }
+
+        /**
+         * @brief Copies the elements of the view into a new list - the only step of a view chain that allocates.
+         * The elements are sorted once while the list is built.
+         * @param allocator - allocator of the new list.
+         * @return A new list with the view elements.
+         */
+        template <class Alloc = std::allocator<value_type>>
+        SortedList<value_type, std::less<value_type>, IdentityKey<value_type>, Alloc>
+        collect(const Alloc &allocator = Alloc()) const
+        {
+            return collectView<value_type, std::less<value_type>, IdentityKey<value_type>>(begin(), end(), allocator);
+        }
+    };
 }
 #endif
\ No newline at end of file
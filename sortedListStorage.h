@@ -0,0 +1,350 @@
+#ifndef SORTED_LIST_STORAGE_H
+#define SORTED_LIST_STORAGE_H
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "snapshotTraits.h"
+#include "sortedList.h"
+
+namespace mtm
+{
+    static const char storage_magic[8] = {'M', 'T', 'M', 'S', 'L', 'S', 'T', '\0'};
+    static const std::uint32_t storage_version = 1;
+    static const std::uint32_t storage_kind_raw = 0;
+    static const std::uint32_t storage_kind_exams = 1;
+    static const std::string storage_format_error = "bad sorted list file";
+    static const std::string storage_write_error = "can't write sorted list";
+    static const std::string storage_open_error = "can't open sorted list file";
+    // elements reserved up front when loading, so a corrupt count can't allocate more than the stream holds.
+    static const std::uint64_t default_storage_reserve = 1 << 20;
+
+    /*
+     * Header of a stored sorted list. The elements follow it in their sorted order, so loading them never compares
+     * anything. Every field is written in the byte order of the machine that wrote it.
+     */
+    class StorageHeader
+    {
+    public:
+        char magic[8];
+        std::uint32_t version;
+        std::uint32_t element_size;
+        std::uint64_t count;
+        std::uint32_t kind;
+        std::uint32_t reserved;
+
+        StorageHeader() : version(0), element_size(0), count(0), kind(0), reserved(0)
+        {
+            std::memset(this->magic, 0, sizeof(this->magic));
+        }
+
+        StorageHeader(const std::uint32_t element_size, const std::uint64_t count, const std::uint32_t kind)
+            : version(storage_version), element_size(element_size), count(count), kind(kind), reserved(0)
+        {
+            std::memcpy(this->magic, storage_magic, sizeof(this->magic));
+        }
+
+        /**
+         * @brief Checks that the header was written by this version for elements of the expected kind and size.
+         * @param expected_size - size of one stored element.
+         * @param expected_kind - kind of the stored list.
+         * @return (void)
+         * @possible_Exceptions - std::runtime_error - if the header doesn't match.
+         */
+        void validate(const std::uint32_t expected_size, const std::uint32_t expected_kind) const
+        {
+            if (std::memcmp(this->magic, storage_magic, sizeof(this->magic)) != 0 ||
+                this->version != storage_version || this->element_size != expected_size ||
+                this->kind != expected_kind)
+            {
+                throw std::runtime_error(storage_format_error);
+            }
+        }
+    };
+
+    /**
+     * writeStorage - writes raw bytes to a stream.
+     * @param os - stream to write to.
+     * @param data - bytes to write.
+     * @param size - number of bytes.
+     * @return (void)
+     * @possible_Exceptions - std::runtime_error - if the stream fails.
+     */
+    inline void writeStorage(std::ostream &os, const void *data, const std::size_t size)
+    {
+        if (!os.write(static_cast<const char *>(data), (std::streamsize)size))
+        {
+            throw std::runtime_error(storage_write_error);
+        }
+    }
+
+    /**
+     * readStorage - reads raw bytes from a stream.
+     * @param is - stream to read from.
+     * @param data - buffer the bytes are read to.
+     * @param size - number of bytes.
+     * @return (void)
+     * @possible_Exceptions - std::runtime_error - if the stream ends before size bytes were read.
+     */
+    inline void readStorage(std::istream &is, void *data, const std::size_t size)
+    {
+        if (!is.read(static_cast<char *>(data), (std::streamsize)size))
+        {
+            throw std::runtime_error(storage_format_error);
+        }
+    }
+
+    /**
+     * saveSortedList - writes the elements of a list, in order, as a versioned binary image.
+     * Only types whose SnapshotTraits are mappable are written this way; other types supply their own overload
+     * (see examStorage.h). The file doesn't record the order of the list and MappedSortedList searches it with
+     * operator<, so only lists in the natural order of T can be saved.
+     * @param list - list to save.
+     * @param os - stream to write to, should be opened in binary mode.
+     * @return (void)
+     * @possible_Exceptions - std::runtime_error - if the stream fails.
+     */
+    template <class T, class Compare, class KeyOf, class Alloc>
+    void saveSortedList(const SortedList<T, Compare, KeyOf, Alloc> &list, std::ostream &os)
+    {
+        static_assert(SnapshotTraits<T>::mappable,
+                      "saveSortedList stores raw bytes - this type needs its own saveSortedList overload");
+        static_assert(std::is_same<Compare, std::less<T>>::value && std::is_same<KeyOf, IdentityKey<T>>::value,
+                      "saveSortedList stores lists in the natural order of T only - MappedSortedList searches with <");
+        StorageHeader header(sizeof(T), (std::uint64_t)list.length(), storage_kind_raw);
+        writeStorage(os, &header, sizeof(header));
+        for (typename SortedList<T, Compare, KeyOf, Alloc>::const_iterator it = list.begin(); !(it == list.end()); ++it)
+        {
+            writeStorage(os, &*it, sizeof(T));
+        }
+    }
+
+    /**
+     * loadSortedList - replaces the elements of a list with the elements stored by saveSortedList, in O(n).
+     * @param is - stream to read from, should be opened in binary mode.
+     * @param list - list to load the elements to.
+     * @return (void)
+     * @possible_Exceptions - std::runtime_error - if the stream doesn't hold a list of this type.
+     */
+    template <class T, class Compare, class KeyOf, class Alloc>
+    void loadSortedList(std::istream &is, SortedList<T, Compare, KeyOf, Alloc> &list)
+    {
+        static_assert(SnapshotTraits<T>::mappable,
+                      "loadSortedList reads raw bytes - this type needs its own loadSortedList overload");
+        StorageHeader header;
+        readStorage(is, &header, sizeof(header));
+        header.validate(sizeof(T), storage_kind_raw);
+
+        std::vector<T> elements;
+        elements.reserve((std::size_t)std::min<std::uint64_t>(header.count, default_storage_reserve));
+        for (std::uint64_t i = 0; i < header.count; i++)
+        {
+            typename std::aligned_storage<sizeof(T), alignof(T)>::type element;
+            readStorage(is, &element, sizeof(T));
+            elements.push_back(*reinterpret_cast<const T *>(&element));
+        }
+        list.assign(elements.begin(), elements.end());
+    }
+
+    /*
+     * MappedSortedList is a read only view of a file written by saveSortedList. The file is mapped to memory and
+     * its elements are used where they are - opening it costs O(1) no matter how many elements it has, and the
+     * pages are read by the system only when they are touched. Searches are binary searches over the mapping.
+     * The file must not change while it is mapped.
+     */
+    template <class T>
+    class MappedSortedList
+    {
+        static_assert(SnapshotTraits<T>::mappable, "MappedSortedList needs a type whose raw bytes can be mapped");
+
+        void *mapping;
+        std::size_t mapping_size;
+        const T *first;
+        const T *last;
+
+    public:
+        typedef const T *const_iterator;
+
+        /**
+         * @brief Maps a file written by saveSortedList.
+         * @param path - path of the file.
+         * @possible_Exceptions - std::runtime_error - if the file can't be opened or doesn't hold a list of T.
+         */
+        explicit MappedSortedList(const std::string &path);
+
+        MappedSortedList(const MappedSortedList &mapped_list) = delete;
+        MappedSortedList &operator=(const MappedSortedList &mapped_list) = delete;
+
+        /**
+         * @brief Unmaps the file.
+         */
+        ~MappedSortedList();
+
+        /**
+         * @brief Length
+         * @return Returns the number of elements in the file.
+         */
+        int length() const;
+
+        const_iterator begin() const;
+        const_iterator end() const;
+
+        /**
+         * @brief Finds the first element that is equal to data, in O(log n).
+         * @param data - data to search for.
+         * @return iterator to the element, or end() if there is none.
+         */
+        const_iterator find(const T &data) const;
+        bool contains(const T &data) const;
+        const_iterator lowerBound(const T &data) const;
+        const_iterator upperBound(const T &data) const;
+        std::pair<const_iterator, const_iterator> equalRange(const T &lo, const T &hi) const;
+        std::pair<const_iterator, const_iterator> equalRange(const T &data) const;
+
+        /**
+         * @brief Lazy filter over the mapped elements, see SortedList::filterView.
+         * @param c A boolian condition which filters only the elements that return true with it.
+         * @return A view over the elements that fulfill c.
+         */
+        template <class Condition>
+        FilterView<const_iterator, Condition> filterView(Condition c) const
+        {
+            return FilterView<const_iterator, Condition>(begin(), end(), c);
+        }
+
+        /**
+         * @brief Lazy operation over the mapped elements, see SortedList::transformView.
+         * @param op - A function that we apply on each element.
+         * @return A view over the results of op.
+         */
+        template <class Operation>
+        TransformView<const_iterator, Operation> transformView(Operation op) const
+        {
+            return TransformView<const_iterator, Operation>(begin(), end(), op);
+        }
+    };
+
+    template <class T>
+    MappedSortedList<T>::MappedSortedList(const std::string &path)
+        : mapping(nullptr), mapping_size(0), first(nullptr), last(nullptr)
+    {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0)
+        {
+            throw std::runtime_error(storage_open_error);
+        }
+        struct stat file_stat;
+        if (::fstat(fd, &file_stat) != 0 || (std::size_t)file_stat.st_size < sizeof(StorageHeader))
+        {
+            ::close(fd);
+            throw std::runtime_error(storage_format_error);
+        }
+        this->mapping_size = (std::size_t)file_stat.st_size;
+        this->mapping = ::mmap(nullptr, this->mapping_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (this->mapping == MAP_FAILED)
+        {
+            throw std::runtime_error(storage_open_error);
+        }
+
+        const StorageHeader *header = static_cast<const StorageHeader *>(this->mapping);
+        try
+        {
+            header->validate(sizeof(T), storage_kind_raw);
+            // the header is 32 bytes long and the mapping is page aligned, so the elements are aligned for T.
+            static_assert(sizeof(StorageHeader) % alignof(T) == 0, "stored elements would be misaligned");
+            if (header->count > (this->mapping_size - sizeof(StorageHeader)) / sizeof(T))
+            {
+                throw std::runtime_error(storage_format_error);
+            }
+        }
+        catch (...)
+        {
+            ::munmap(this->mapping, this->mapping_size);
+            throw;
+        }
+        this->first = reinterpret_cast<const T *>(header + 1);
+        this->last = this->first + header->count;
+    }
+
+    template <class T>
+    MappedSortedList<T>::~MappedSortedList()
+    {
+        ::munmap(this->mapping, this->mapping_size);
+    }
+
+    template <class T>
+    int MappedSortedList<T>::length() const
+    {
+        return (int)(this->last - this->first);
+    }
+
+    template <class T>
+    typename MappedSortedList<T>::const_iterator MappedSortedList<T>::begin() const
+    {
+        return this->first;
+    }
+
+    template <class T>
+    typename MappedSortedList<T>::const_iterator MappedSortedList<T>::end() const
+    {
+        return this->last;
+    }
+
+    template <class T>
+    typename MappedSortedList<T>::const_iterator MappedSortedList<T>::find(const T &data) const
+    {
+        const_iterator it = lowerBound(data);
+        if (it == this->last || data < *it)
+        {
+            return this->last;
+        }
+        return it;
+    }
+
+    template <class T>
+    bool MappedSortedList<T>::contains(const T &data) const
+    {
+        return find(data) != this->last;
+    }
+
+    template <class T>
+    typename MappedSortedList<T>::const_iterator MappedSortedList<T>::lowerBound(const T &data) const
+    {
+        return std::lower_bound(this->first, this->last, data);
+    }
+
+    template <class T>
+    typename MappedSortedList<T>::const_iterator MappedSortedList<T>::upperBound(const T &data) const
+    {
+        return std::upper_bound(this->first, this->last, data);
+    }
+
+    template <class T>
+    std::pair<typename MappedSortedList<T>::const_iterator, typename MappedSortedList<T>::const_iterator>
+    MappedSortedList<T>::equalRange(const T &lo, const T &hi) const
+    {
+        const_iterator range_first = lowerBound(lo);
+        const_iterator range_last = hi < lo ? range_first : std::upper_bound(range_first, this->last, hi);
+        return std::make_pair(range_first, range_last);
+    }
+
+    template <class T>
+    std::pair<typename MappedSortedList<T>::const_iterator, typename MappedSortedList<T>::const_iterator>
+    MappedSortedList<T>::equalRange(const T &data) const
+    {
+        return equalRange(data, data);
+    }
+}
+#endif
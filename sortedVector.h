@@ -0,0 +1,454 @@
+#ifndef SORTED_VECTOR_H
+#define SORTED_VECTOR_H
+#include <algorithm>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "sortedList.h"
+
+namespace mtm
+{
+    /*
+     * SortedVector keeps its elements sorted in one contiguous array. It has the public interface of SortedList,
+     * but trades the O(log n) insert and O(1) remove of the list for cache friendly scanning - iterating over the
+     * elements reads them one after the other in memory instead of chasing a pointer per element.
+     * Use it for data that is built once (preferably with the range constructor) and scanned many times.
+     */
+    template <class T, class Alloc = std::allocator<T>>
+    class SortedVector
+    {
+        std::vector<T, Alloc> elements;
+
+        /**
+         * @brief Sorts the elements, unless they are already sorted. Equal elements keep their order.
+         * @return (void)
+         */
+        void sortElements();
+
+    public:
+        class const_iterator;
+        /**
+         * @brief Constructs a new empty vector.
+         */
+        SortedVector() = default;
+
+        /**
+         * @brief Constructs a new empty vector which allocates its elements through allocator.
+         * @param allocator - std::allocator compatible allocator.
+         */
+        explicit SortedVector(const Alloc &allocator);
+
+        /**
+         * @brief Constructs a new vector from the elements of a range, sorting them once.
+         * @param first - iterator to the first element of the range.
+         * @param last - iterator past the last element of the range.
+         * @param allocator - allocator the vector allocates its elements with.
+         */
+        template <class InputIterator>
+        SortedVector(InputIterator first, InputIterator last, const Alloc &allocator = Alloc());
+
+        SortedVector(const SortedVector &sorted_vector) = default;
+        SortedVector(SortedVector &&sorted_vector) = default;
+        ~SortedVector() = default;
+        SortedVector &operator=(const SortedVector &other_vector) = default;
+        SortedVector &operator=(SortedVector &&other_vector) = default;
+
+        /**
+         * @brief inserts a new data to the vector while keeping it sorted. Finding the place takes O(log n), but
+         * the elements after it are shifted, so inserting takes O(n).
+         * @param data - new data we want to insert into the vector.
+         * @return A const iterator that points to the new element.
+         */
+        const_iterator insert(const T &data);
+
+        /**
+         * @brief inserts a new data to the vector by moving it in.
+         * @param data - new data we want to move into the vector.
+         * @return A const iterator that points to the new element.
+         */
+        const_iterator insert(T &&data);
+
+        /**
+         * @brief Constructs a new element and inserts it while keeping the vector sorted.
+         * @param args - arguments for the constructor of the new element.
+         * @return A const iterator that points to the new element.
+         */
+        template <class... Args>
+        const_iterator emplace(Args &&...args);
+
+        /**
+         * @brief Replaces the vector elements with the elements of a range, sorting them once.
+         * @param first - iterator to the first element of the range.
+         * @param last - iterator past the last element of the range.
+         * @return (void)
+         */
+        template <class InputIterator>
+        void assign(InputIterator first, InputIterator last);
+
+        /**
+         * @brief inserts all the elements of a range while keeping the vector sorted, by sorting the range once
+         * and merging it with the vector.
+         * @param first - iterator to the first element of the range.
+         * @param last - iterator past the last element of the range.
+         * @return (void)
+         */
+        template <class InputIterator>
+        void insertRange(InputIterator first, InputIterator last);
+
+        /**
+         * @brief Removes a specific data from the vector which the iterator point to. The elements after it are
+         * shifted, so removing takes O(n). An iterator of another vector is ignored.
+         * @param iterator - iterator which points to the element we want to remove.
+         * @return (void)
+         * @possible_Exceptions - std::out_of_range - if the iterator is pointing outside of the vector.
+         */
+        void remove(const const_iterator &iterator);
+
+        /**
+         * @brief Length
+         * @return Returns the number of elements in the vector.
+         */
+        int length() const;
+
+        /**
+         * @brief Runs over the vector with a boolian expression and filters the vector to a new one.
+         * @param c A boolian condition which filters only the elements that return true with it.
+         * @return A new result vector after the filter was applied.
+         */
+        template <class Condition>
+        SortedVector filter(Condition c) const;
+
+        /**
+         * @brief Runs over the vector with a function and applies changes on the vector elements, then sorts the
+         * results into a new vector.
+         * @param op - A function that we apply on each element in the vector.
+         * @return - A new result vector with the results of op.
+         */
+        template <class Operation>
+        SortedVector apply(Operation op) const;
+
+        /**
+         * @brief Searches the vector for an element equal to data, in O(log n).
+         * @param data - data to search for.
+         * @return A const iterator that points to the first element equal to data, end() if there is none.
+         */
+        const_iterator find(const T &data) const;
+
+        /**
+         * @brief Checks if the vector holds an element equal to data, in O(log n).
+         * @param data - data to search for.
+         * @return true - if an equal element is in the vector, false - otherwise.
+         */
+        bool contains(const T &data) const;
+
+        /**
+         * @brief lowerBound
+         * @param data - data to search for.
+         * @return A const iterator that points to the first element which is not smaller than data.
+         */
+        const_iterator lowerBound(const T &data) const;
+
+        /**
+         * @brief upperBound
+         * @param data - data to search for.
+         * @return A const iterator that points to the first element which is bigger than data.
+         */
+        const_iterator upperBound(const T &data) const;
+
+        /**
+         * @brief Finds all the elements between two bounds, in O(log n).
+         * @param lo - lower bound of the range.
+         * @param hi - upper bound of the range.
+         * @return A pair of const iterators which surrounds every lo <= element <= hi, an empty range if hi < lo.
+         */
+        std::pair<const_iterator, const_iterator> equalRange(const T &lo, const T &hi) const;
+
+        /**
+         * @brief begin
+         * @return A const iterator that points to the first element of the vector
+         */
+        const_iterator begin() const;
+
+        /**
+         * @brief end
+         * @return A const iterator that points past the last element of the vector
+         */
+        const_iterator end() const;
+
+        /**
+         * @brief Creates a lazy view of the vector elements that fulfill a condition.
+         * @param c A boolian condition which filters only the elements that return true with it.
+         * @return A view over the filtered elements, valid as long as the vector is not changed.
+         */
+        template <class Condition>
+        FilterView<const_iterator, Condition> filterView(Condition c) const;
+
+        /**
+         * @brief Creates a lazy view of the vector elements after an operation.
+         * @param op - A function that we apply on each element in the vector.
+         * @return A view over the results of op, valid as long as the vector is not changed.
+         */
+        template <class Operation>
+        TransformView<const_iterator, Operation> transformView(Operation op) const;
+    };
+
+    template <class T, class Alloc>
+    class SortedVector<T, Alloc>::const_iterator
+    {
+        const T *element;
+        const T *last;
+        /**
+         * @brief Constructs a new const_iterator which points to an element of the vector.
+         * @param element - element which the iterator points to, last for the end of the vector.
+         * @param last - pointer past the last element of the vector.
+         */
+        const_iterator(const T *element, const T *last) : element(element), last(last) {}
+        friend class SortedVector<T, Alloc>;
+
+    public:
+        const_iterator() = delete;
+        const_iterator(const const_iterator &other_it) = default;
+        ~const_iterator() = default;
+        const_iterator &operator=(const const_iterator &it) = default;
+
+        /**
+         * @brief
+         * @return Returns the data which the const_iterator points to.
+         * @possivle_Exceptions - std::out_of_range - if the iterator points to the end of the vector.
+         */
+        const T &operator*() const
+        {
+            if (this->element == this->last)
+            {
+                throw std::out_of_range(out_of_range_error);
+            }
+            return *this->element;
+        }
+
+        /**
+         * @brief advances the iterator to the next element in the vector and returns it.
+         * @return this after we advanced it.
+         * @possivle_Exceptions - std::out_of_range - if the iterator points to the end of the vector.
+         */
+        const_iterator &operator++()
+        {
+            if (this->element == this->last)
+            {
+                throw std::out_of_range(out_of_range_error);
+            }
+            ++this->element;
+            return *this;
+        }
+
+        /**
+         * @brief advances the iterator to the next element but returns it's location before the advancement.
+         * @return this before we advanced it.
+         * @possivle_Exceptions - std::out_of_range - if the iterator points to the end of the vector.
+         */
+        const_iterator operator++(int)
+        {
+            const_iterator result = *this;
+            ++*this;
+            return result;
+        }
+
+        /**
+         * @brief checks if two iterators from the same vector points to the same element in that vector.
+         * @param it - other iterator to compare with.
+         * @return true - if iterators points to the same element, false - otherwise.
+         */
+        bool operator==(const const_iterator &it) const { return this->element == it.element; }
+    };
+
+    template <class T, class Alloc>
+    SortedVector<T, Alloc>::SortedVector(const Alloc &allocator) : elements(allocator)
+    {
+    }
+
+    template <class T, class Alloc>
+    template <class InputIterator>
+    SortedVector<T, Alloc>::SortedVector(InputIterator first, InputIterator last, const Alloc &allocator)
+        : elements(first, last, allocator)
+    {
+        sortElements();
+    }
+
+    template <class T, class Alloc>
+    void SortedVector<T, Alloc>::sortElements()
+    {
+        if (!std::is_sorted(this->elements.begin(), this->elements.end()))
+        {
+            std::stable_sort(this->elements.begin(), this->elements.end());
+        }
+    }
+
+    template <class T, class Alloc>
+    typename SortedVector<T, Alloc>::const_iterator SortedVector<T, Alloc>::insert(const T &data)
+    {
+        return emplace(data);
+    }
+
+    template <class T, class Alloc>
+    typename SortedVector<T, Alloc>::const_iterator SortedVector<T, Alloc>::insert(T &&data)
+    {
+        return emplace(std::move(data));
+    }
+
+    template <class T, class Alloc>
+    template <class... Args>
+    typename SortedVector<T, Alloc>::const_iterator SortedVector<T, Alloc>::emplace(Args &&...args)
+    {
+        T data(std::forward<Args>(args)...);
+        typename std::vector<T, Alloc>::iterator position =
+            std::upper_bound(this->elements.begin(), this->elements.end(), data);
+        position = this->elements.insert(position, std::move(data));
+        return const_iterator(&*position, this->elements.data() + this->elements.size());
+    }
+
+    template <class T, class Alloc>
+    template <class InputIterator>
+    void SortedVector<T, Alloc>::assign(InputIterator first, InputIterator last)
+    {
+        this->elements.assign(first, last);
+        sortElements();
+    }
+
+    template <class T, class Alloc>
+    template <class InputIterator>
+    void SortedVector<T, Alloc>::insertRange(InputIterator first, InputIterator last)
+    {
+        typename std::vector<T, Alloc>::difference_type old_size = this->elements.size();
+        this->elements.insert(this->elements.end(), first, last);
+        typename std::vector<T, Alloc>::iterator middle = this->elements.begin() + old_size;
+        if (!std::is_sorted(middle, this->elements.end()))
+        {
+            std::stable_sort(middle, this->elements.end());
+        }
+        std::inplace_merge(this->elements.begin(), middle, this->elements.end());
+    }
+
+    template <class T, class Alloc>
+    void SortedVector<T, Alloc>::remove(const const_iterator &iterator)
+    {
+        const T *first = this->elements.data(), *last = first + this->elements.size();
+        if (iterator.element == iterator.last)
+        {
+            throw std::out_of_range(out_of_range_error);
+        }
+        if (iterator.element < first || iterator.element >= last)
+        {
+            return;
+        }
+        this->elements.erase(this->elements.begin() + (iterator.element - first));
+    }
+
+    template <class T, class Alloc>
+    int SortedVector<T, Alloc>::length() const
+    {
+        return static_cast<int>(this->elements.size());
+    }
+
+    template <class T, class Alloc>
+    template <class Condition>
+    SortedVector<T, Alloc> SortedVector<T, Alloc>::filter(Condition c) const
+    {
+        SortedVector<T, Alloc> result(this->elements.get_allocator());
+        for (typename std::vector<T, Alloc>::const_iterator it = this->elements.begin(); it != this->elements.end();
+             ++it)
+        {
+            if (c(*it))
+            {
+                result.elements.push_back(*it);
+            }
+        }
+        return result;
+    }
+
+    template <class T, class Alloc>
+    template <class Operation>
+    SortedVector<T, Alloc> SortedVector<T, Alloc>::apply(Operation op) const
+    {
+        SortedVector<T, Alloc> result(this->elements.get_allocator());
+        result.elements.reserve(this->elements.size());
+        for (typename std::vector<T, Alloc>::const_iterator it = this->elements.begin(); it != this->elements.end();
+             ++it)
+        {
+            result.elements.push_back(op(*it));
+        }
+        result.sortElements();
+        return result;
+    }
+
+    template <class T, class Alloc>
+    typename SortedVector<T, Alloc>::const_iterator SortedVector<T, Alloc>::find(const T &data) const
+    {
+        const_iterator it = lowerBound(data);
+        if (it == end() || data < *it)
+        {
+            return end();
+        }
+        return it;
+    }
+
+    template <class T, class Alloc>
+    bool SortedVector<T, Alloc>::contains(const T &data) const
+    {
+        return std::binary_search(this->elements.begin(), this->elements.end(), data);
+    }
+
+    template <class T, class Alloc>
+    typename SortedVector<T, Alloc>::const_iterator SortedVector<T, Alloc>::lowerBound(const T &data) const
+    {
+        const T *first = this->elements.data(), *last = first + this->elements.size();
+        return const_iterator(std::lower_bound(first, last, data), last);
+    }
+
+    template <class T, class Alloc>
+    typename SortedVector<T, Alloc>::const_iterator SortedVector<T, Alloc>::upperBound(const T &data) const
+    {
+        const T *first = this->elements.data(), *last = first + this->elements.size();
+        return const_iterator(std::upper_bound(first, last, data), last);
+    }
+
+    template <class T, class Alloc>
+    std::pair<typename SortedVector<T, Alloc>::const_iterator, typename SortedVector<T, Alloc>::const_iterator>
+    SortedVector<T, Alloc>::equalRange(const T &lo, const T &hi) const
+    {
+        const_iterator range_first = lowerBound(lo);
+        return std::make_pair(range_first, hi < lo ? range_first : upperBound(hi));
+    }
+
+    template <class T, class Alloc>
+    typename SortedVector<T, Alloc>::const_iterator SortedVector<T, Alloc>::begin() const
+    {
+        const T *first = this->elements.data();
+        return const_iterator(first, first + this->elements.size());
+    }
+
+    template <class T, class Alloc>
+    typename SortedVector<T, Alloc>::const_iterator SortedVector<T, Alloc>::end() const
+    {
+        const T *last = this->elements.data() + this->elements.size();
+        return const_iterator(last, last);
+    }
+
+    template <class T, class Alloc>
+    template <class Condition>
+    FilterView<typename SortedVector<T, Alloc>::const_iterator, Condition> SortedVector<T, Alloc>::filterView(
+        Condition c) const
+    {
+        return FilterView<const_iterator, Condition>(begin(), end(), c);
+    }
+
+    template <class T, class Alloc>
+    template <class Operation>
+    TransformView<typename SortedVector<T, Alloc>::const_iterator, Operation> SortedVector<T, Alloc>::transformView(
+        Operation op) const
+    {
+        return TransformView<const_iterator, Operation>(begin(), end(), op);
+    }
+}
+#endif
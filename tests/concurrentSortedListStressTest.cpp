@@ -0,0 +1,126 @@
+/*
+ * Runs inserts, removes, lookups and traversals on one ConcurrentSortedList from many threads at once.
+ * Every writer owns the keys that are equal to its number modulo the writer count, so it knows exactly how many
+ * copies of each of its keys the list holds and can check every contains() it makes. Traversing threads check
+ * that the list is sorted whenever they walk it. At the end the list must hold exactly the net inserts of all the
+ * writers.
+ */
+#include <algorithm>
+#include <atomic>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "concurrentSortedList.h"
+#include "testCheck.h"
+
+namespace
+{
+    const int writer_count = 6;
+    const int reader_count = 2;
+    const int keys_per_writer = 64;
+    const int operations_per_writer = 5000;
+    const unsigned int stress_seed = 12345u;
+
+    class WriterModel
+    {
+    public:
+        // copies of each key of the writer in the list, indexed by key / writer_count.
+        std::vector<int> copies;
+        int net_inserts;
+        WriterModel() : copies(keys_per_writer, 0), net_inserts(0) {}
+    };
+
+    void runWriter(mtm::ConcurrentSortedList<int> &list, const int writer, WriterModel &model)
+    {
+        std::mt19937 generator(stress_seed + writer);
+        for (int i = 0; i < operations_per_writer; i++)
+        {
+            int slot = (int)(generator() % keys_per_writer);
+            int key = slot * writer_count + writer;
+            switch (generator() % 3)
+            {
+            case 0:
+                list.insert(key);
+                model.copies[slot]++;
+                model.net_inserts++;
+                break;
+            case 1:
+            {
+                bool removed = list.remove(key);
+                MTM_CHECK(removed == (model.copies[slot] > 0));
+                if (removed)
+                {
+                    model.copies[slot]--;
+                    model.net_inserts--;
+                }
+                break;
+            }
+            default:
+                MTM_CHECK(list.contains(key) == (model.copies[slot] > 0));
+                break;
+            }
+        }
+    }
+
+    void runReader(mtm::ConcurrentSortedList<int> &list, const std::atomic<bool> &writers_done)
+    {
+        int traversals = 0;
+        while (!writers_done.load() || traversals == 0)
+        {
+            int previous = -1;
+            bool sorted = true;
+            list.forEach([&previous, &sorted](const int key) {
+                sorted = sorted && previous <= key;
+                previous = key;
+            });
+            MTM_CHECK(sorted);
+            traversals++;
+        }
+    }
+}
+
+int main()
+{
+    mtm::ConcurrentSortedList<int> list;
+    std::vector<WriterModel> models(writer_count);
+    std::atomic<bool> writers_done(false);
+
+    std::vector<std::thread> readers;
+    for (int reader = 0; reader < reader_count; reader++)
+    {
+        readers.push_back(std::thread([&list, &writers_done]() { runReader(list, writers_done); }));
+    }
+    std::vector<std::thread> writers;
+    for (int writer = 0; writer < writer_count; writer++)
+    {
+        writers.push_back(std::thread([&list, &models, writer]() { runWriter(list, writer, models[writer]); }));
+    }
+    for (std::vector<std::thread>::iterator it = writers.begin(); it != writers.end(); ++it)
+    {
+        it->join();
+    }
+    writers_done.store(true);
+    for (std::vector<std::thread>::iterator it = readers.begin(); it != readers.end(); ++it)
+    {
+        it->join();
+    }
+
+    int net_inserts = 0;
+    std::vector<int> expected;
+    for (int writer = 0; writer < writer_count; writer++)
+    {
+        net_inserts += models[writer].net_inserts;
+        for (int slot = 0; slot < keys_per_writer; slot++)
+        {
+            expected.insert(expected.end(), models[writer].copies[slot], slot * writer_count + writer);
+        }
+    }
+    std::sort(expected.begin(), expected.end());
+    MTM_CHECK(list.length() == net_inserts);
+
+    std::vector<int> found;
+    list.forEach([&found](const int key) { found.push_back(key); });
+    MTM_CHECK(found == expected);
+    return mtm_test::testResult();
+}
@@ -0,0 +1,123 @@
+/*
+ * Checks that NodePool::release frees every block of the pool, including the blocks too big for a size class,
+ * so that dropping the nodes of a list and releasing its pool gives all of its memory back to the system.
+ * The test counts the live allocations by replacing the global operator new and operator delete.
+ */
+#include <cstdlib>
+#include <new>
+
+#include "nodePool.h"
+#include "sortedList.h"
+#include "testCheck.h"
+
+namespace
+{
+    long live_allocations = 0;
+}
+
+void *operator new(std::size_t bytes)
+{
+    void *block = std::malloc(bytes == 0 ? 1 : bytes);
+    if (block == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    live_allocations++;
+    return block;
+}
+
+void operator delete(void *block) noexcept
+{
+    if (block != nullptr)
+    {
+        live_allocations--;
+        std::free(block);
+    }
+}
+
+namespace
+{
+    // bigger than the biggest size class of the pool, so every node is allocated on its own.
+    struct Oversized
+    {
+        int key;
+        char padding[600];
+
+        bool operator<(const Oversized &other) const { return this->key < other.key; }
+    };
+
+    typedef mtm::SortedList<Oversized, std::less<Oversized>, mtm::IdentityKey<Oversized>,
+                            mtm::PoolAllocator<Oversized>>
+        OversizedList;
+    typedef mtm::SortedList<int, std::less<int>, mtm::IdentityKey<int>, mtm::PoolAllocator<int>> SmallList;
+
+    const int element_count = 100;
+
+    Oversized makeOversized(const int key)
+    {
+        Oversized element = Oversized();
+        element.key = key;
+        return element;
+    }
+
+    void checkDropOversized()
+    {
+        mtm::NodePool pool;
+        OversizedList list((mtm::PoolAllocator<Oversized>(pool)));
+        long before = live_allocations;
+        for (int i = 0; i < element_count; i++)
+        {
+            list.insert(makeOversized((i * 37) % element_count));
+        }
+        MTM_CHECK(live_allocations - before >= element_count);
+        list.dropNodes();
+        pool.release();
+        MTM_CHECK(live_allocations == before);
+        MTM_CHECK(list.length() == 0);
+
+        list.insert(makeOversized(1));
+        MTM_CHECK(list.length() == 1 && (*list.begin()).key == 1);
+    }
+
+    void checkRemoveOversized()
+    {
+        mtm::NodePool pool;
+        OversizedList list((mtm::PoolAllocator<Oversized>(pool)));
+        long before = live_allocations;
+        for (int i = 0; i < element_count; i++)
+        {
+            list.insert(makeOversized(i));
+        }
+        // the pool unlinks the big blocks the list gives back, so release doesn't free them a second time.
+        for (int i = 0; i < element_count; i += 2)
+        {
+            list.remove(list.find(makeOversized(i)));
+        }
+        MTM_CHECK(list.length() == element_count / 2);
+        list.dropNodes();
+        pool.release();
+        MTM_CHECK(live_allocations == before);
+    }
+
+    void checkDropSmall()
+    {
+        mtm::NodePool pool;
+        SmallList list((mtm::PoolAllocator<int>(pool)));
+        long before = live_allocations;
+        for (int i = 0; i < 10 * element_count; i++)
+        {
+            list.insert(i);
+        }
+        list.dropNodes();
+        pool.release();
+        MTM_CHECK(live_allocations == before);
+    }
+}
+
+int main()
+{
+    checkDropOversized();
+    checkRemoveOversized();
+    checkDropSmall();
+    return mtm_test::testResult();
+}
@@ -0,0 +1,120 @@
+/*
+ * Counts the copies and moves SortedList makes of its elements: inserting an rvalue or emplacing must not copy
+ * the element at all, and inserting an lvalue must copy it exactly once - into its node.
+ */
+#include <string>
+#include <utility>
+
+#include "sortedList.h"
+#include "testCheck.h"
+
+namespace
+{
+    class Counted
+    {
+        int key;
+        std::string payload;
+
+    public:
+        static int copies;
+        static int moves;
+
+        Counted(const int key, const std::string &payload) : key(key), payload(payload) {}
+        Counted(const Counted &other) : key(other.key), payload(other.payload) { copies++; }
+        Counted(Counted &&other) : key(other.key), payload(std::move(other.payload)) { moves++; }
+        Counted &operator=(const Counted &other)
+        {
+            this->key = other.key;
+            this->payload = other.payload;
+            copies++;
+            return *this;
+        }
+        Counted &operator=(Counted &&other)
+        {
+            this->key = other.key;
+            this->payload = std::move(other.payload);
+            moves++;
+            return *this;
+        }
+
+        bool operator<(const Counted &other) const { return this->key < other.key; }
+        int getKey() const { return this->key; }
+
+        static void resetCounts()
+        {
+            copies = 0;
+            moves = 0;
+        }
+    };
+
+    int Counted::copies = 0;
+    int Counted::moves = 0;
+
+    const int element_count = 1000;
+    const std::string payload = "https://tinyurl.com/a-link-long-enough-to-live-on-the-heap";
+
+    void checkInsertRvalue()
+    {
+        mtm::SortedList<Counted> list;
+        Counted::resetCounts();
+        for (int i = 0; i < element_count; i++)
+        {
+            list.insert(Counted((i * 7919) % element_count, payload));
+        }
+        MTM_CHECK(Counted::copies == 0);
+        MTM_CHECK(Counted::moves == element_count);
+        MTM_CHECK(list.length() == element_count);
+    }
+
+    void checkEmplace()
+    {
+        mtm::SortedList<Counted> list;
+        Counted::resetCounts();
+        for (int i = 0; i < element_count; i++)
+        {
+            list.emplace((i * 7919) % element_count, payload);
+        }
+        MTM_CHECK(Counted::copies == 0);
+        MTM_CHECK(Counted::moves == 0);
+        MTM_CHECK((*list.begin()).getKey() == 0);
+    }
+
+    void checkInsertLvalue()
+    {
+        mtm::SortedList<Counted> list;
+        Counted element(0, payload);
+        Counted::resetCounts();
+        for (int i = 0; i < element_count; i++)
+        {
+            list.insert(element);
+        }
+        MTM_CHECK(Counted::copies == element_count);
+        MTM_CHECK(Counted::moves == 0);
+    }
+
+    void checkMoveList()
+    {
+        mtm::SortedList<Counted> list;
+        for (int i = 0; i < element_count; i++)
+        {
+            list.emplace(i, payload);
+        }
+        Counted::resetCounts();
+        mtm::SortedList<Counted> moved(std::move(list));
+        mtm::SortedList<Counted> assigned;
+        assigned = std::move(moved);
+        MTM_CHECK(Counted::copies == 0);
+        MTM_CHECK(Counted::moves == 0);
+        MTM_CHECK(assigned.length() == element_count);
+        MTM_CHECK(list.length() == 0);
+    }
+}
+
+int main()
+{
+    checkInsertRvalue();
+    checkEmplace();
+    checkInsertLvalue();
+    checkMoveList();
+    return mtm_test::testResult();
+}
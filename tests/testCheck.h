@@ -0,0 +1,38 @@
+#ifndef TEST_CHECK_H
+#define TEST_CHECK_H
+#include <atomic>
+#include <iostream>
+
+/*
+ * Minimal checks for the tests - unlike assert they stay on in Release builds. A failed check is reported and
+ * makes testResult() fail, the test goes on to report the rest.
+ */
+namespace mtm_test
+{
+    inline std::atomic<int> &failedChecks()
+    {
+        static std::atomic<int> failed(0);
+        return failed;
+    }
+
+    inline void check(const bool condition, const char *text, const char *file, const int line)
+    {
+        if (!condition)
+        {
+            failedChecks()++;
+            std::cerr << file << ":" << line << ": check failed: " << text << std::endl;
+        }
+    }
+
+    /**
+     * testResult
+     * @return exit code of the test - 0 if every check passed, 1 otherwise.
+     */
+    inline int testResult()
+    {
+        return failedChecks().load() == 0 ? 0 : 1;
+    }
+}
+
+#define MTM_CHECK(condition) mtm_test::check((condition), #condition, __FILE__, __LINE__)
+#endif